@@ -0,0 +1,117 @@
+/*
+ * CoDel 准入控制基准测试
+ * 用 RpcExecutor 模拟服务端：4 个工作线程，每个请求耗时 2ms（服务能力约 2000 req/s）
+ * 以 2 倍服务能力的速率开环投递请求，客户端超时时间为 200ms，统计：
+ * 1. goodput：在超时时间内完成的请求速率
+ * 2. p99：已完成请求的 99 分位延迟（入队到执行完成）
+ * 3. shed：被准入控制丢弃的请求数
+ * 分别在关闭 CoDel、CoDel + drop_oldest、CoDel + lifo 三种配置下运行
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "rpcexecutor.h"
+
+using Clock = std::chrono::steady_clock;
+
+static const int kThreads = 4;
+static const auto kServiceTime = std::chrono::milliseconds(2);
+static const auto kTimeout = std::chrono::milliseconds(200);
+static const auto kDuration = std::chrono::seconds(3);
+static const double kOverload = 2.0;
+
+struct BenchResult {
+    double goodput = 0;     // 超时时间内完成的请求速率 (req/s)
+    double p99_ms = 0;      // 已完成请求的 p99 延迟 (ms)
+    size_t completed = 0;   // 已完成的请求数
+    size_t shed = 0;        // 被丢弃的请求数
+};
+
+BenchResult RunBench(const RpcExecutor::Options& options) {
+    std::mutex mutex;
+    std::vector<double> latencies_ms;   // 已完成请求的延迟
+    std::atomic<size_t> shed{0};
+    std::atomic<size_t> good{0};
+
+    RpcExecutor executor(options);
+
+    // 开环投递：按固定速率提交请求，不等待请求完成
+    double rate = kOverload * kThreads * 1000.0 / kServiceTime.count();
+    auto gap = std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(1.0 / rate));
+    auto start = Clock::now();
+    for (long i = 0; Clock::now() - start < kDuration; ++i) {
+        std::this_thread::sleep_until(start + i * gap);
+        auto submit = Clock::now();
+        executor.Submit(
+            RpcExecutor::Priority::Normal,
+            "bench",
+            [&, submit]() {
+                std::this_thread::sleep_for(kServiceTime);  // 模拟服务方法耗时
+                auto latency = Clock::now() - submit;
+                if (latency <= kTimeout) {
+                    ++good;
+                }
+                std::lock_guard<std::mutex> lock(mutex);
+                latencies_ms.push_back(std::chrono::duration<double, std::milli>(latency).count());
+            },
+            [&]() { ++shed; }
+        );
+    }
+
+    // 等待一个超时时间，让已经不可能按时完成的请求自然结束统计，剩余积压直接丢弃
+    std::this_thread::sleep_for(kTimeout);
+    executor.Stop();
+
+    BenchResult result;
+    result.goodput = good / std::chrono::duration<double>(kDuration).count();
+    result.shed = shed;
+    std::lock_guard<std::mutex> lock(mutex);
+    result.completed = latencies_ms.size();
+    if (!latencies_ms.empty()) {
+        std::sort(latencies_ms.begin(), latencies_ms.end());
+        result.p99_ms = latencies_ms[latencies_ms.size() * 99 / 100];
+    }
+    return result;
+}
+
+int main() {
+    struct Case {
+        const char* name;
+        bool codel;
+        RpcExecutor::ShedMode mode;
+    };
+    Case cases[] = {
+        {"no codel", false, RpcExecutor::ShedMode::DropOldest},
+        {"codel drop_oldest", true, RpcExecutor::ShedMode::DropOldest},
+        {"codel lifo", true, RpcExecutor::ShedMode::Lifo},
+    };
+
+    std::cout << "capacity ~" << kThreads * 1000 / kServiceTime.count() << " req/s, offered "
+              << kOverload << "x, timeout " << kTimeout.count() << "ms" << std::endl;
+    std::cout << std::left << std::setw(20) << "mode"
+              << std::setw(16) << "goodput(req/s)"
+              << std::setw(12) << "p99(ms)"
+              << std::setw(12) << "completed"
+              << std::setw(12) << "shed" << std::endl;
+
+    for (const Case& c : cases) {
+        RpcExecutor::Options options;
+        options.threads = kThreads;
+        options.codel_enable = c.codel;
+        options.shed_mode = c.mode;
+
+        BenchResult result = RunBench(options);
+        std::cout << std::left << std::setw(20) << c.name
+                  << std::setw(16) << std::fixed << std::setprecision(0) << result.goodput
+                  << std::setw(12) << std::setprecision(1) << result.p99_ms
+                  << std::setw(12) << result.completed
+                  << std::setw(12) << result.shed << std::endl;
+    }
+    return 0;
+}
@@ -0,0 +1,194 @@
+/*
+ * 消息体压缩基准测试
+ * 用不同长度的请求消息（结构化文本记录，接近常见的业务数据）扫描各个可用的压缩算法，统计：
+ * 1. 压缩率（压缩后长度 / 原长度）
+ * 2. 压缩、解压耗时 (us)
+ * 3. 净收益：节省的传输时间 - 压缩与解压耗时，分别按 1Gbps / 10Gbps 链路计算 (us)
+ * 净收益转正的最小消息长度即为该链路上的盈亏平衡点，可据此设置 compression.threshold；
+ * 编译时找到 zstd 时，再比较小消息在使用/不使用按方法训练的字典时的压缩率
+ *
+ * 用法: compression_bench
+ */
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+#include "rpccompress.h"
+#include "rpcheader.pb.h"
+#include "user.pb.h"
+
+using Clock = std::chrono::steady_clock;
+
+static const size_t kSizes[] = {64, 256, 1024, 4096, 16 * 1024, 64 * 1024, 256 * 1024, 1024 * 1024};
+static const size_t kBytesPerRun = 16 * 1024 * 1024;   // 每种长度处理的数据总量，小消息重复更多次
+static const double kLinks[] = {1e9, 10e9};             // 链路带宽 (bit/s)
+
+struct BenchResult {
+    double ratio = 1;       // 压缩率
+    double compress_us = 0; // 单条消息的压缩耗时
+    double decompress_us = 0;
+};
+
+// 生成约 size 字节的请求消息：用户记录拼接成的文本，字段名重复、取值随机
+std::string BuildPayload(size_t size, std::mt19937* rng) {
+    static const char* kCities[] = {"Beijing", "Shanghai", "Shenzhen", "Hangzhou", "Chengdu", "Wuhan"};
+    std::uniform_int_distribution<int> id(100000, 999999);
+    std::uniform_int_distribution<int> city(0, 5);
+    std::uniform_int_distribution<int> age(18, 80);
+
+    std::string text;
+    while (text.size() < size) {
+        int user = id(*rng);
+        text += "{\"id\":" + std::to_string(user) + ",\"name\":\"user_" + std::to_string(user) +
+                "\",\"email\":\"user_" + std::to_string(user) + "@example.com\",\"city\":\"" + kCities[city(*rng)] +
+                "\",\"age\":" + std::to_string(age(*rng)) + ",\"active\":true}";
+    }
+    text.resize(size);
+
+    fixbug::RegisterRequest request;
+    request.set_id(id(*rng));
+    request.set_username(text);
+    request.set_password("123456");
+    return request.SerializeAsString();
+}
+
+BenchResult RunBench(const RpcCompressor& compressor, const google::protobuf::MethodDescriptor* method,
+                     const std::string& payload) {
+    BenchResult result;
+    size_t reps = std::max<size_t>(20, kBytesPerRun / payload.size());
+    uint32_t peer_mask = RpcCompressor::SupportedMask();
+
+    std::string compressed;
+    int algorithm = rpcheader::COMPRESS_NONE;
+    auto start = Clock::now();
+    for (size_t i = 0; i < reps; ++i) {
+        compressed = payload;
+        algorithm = compressor.Compress(method, peer_mask, &compressed);
+    }
+    result.compress_us = std::chrono::duration<double, std::micro>(Clock::now() - start).count() / reps;
+    if (algorithm == rpcheader::COMPRESS_NONE) {
+        return result;  // 压缩后没有变小，按原样发送
+    }
+    result.ratio = static_cast<double>(compressed.size()) / payload.size();
+
+    std::string plain;
+    start = Clock::now();
+    for (size_t i = 0; i < reps; ++i) {
+        compressor.Decompress(algorithm, compressed.data(), compressed.size(), payload.size(), &plain);
+    }
+    result.decompress_us = std::chrono::duration<double, std::micro>(Clock::now() - start).count() / reps;
+    if (plain != payload) {
+        std::cerr << "decompressed payload mismatch!" << std::endl;
+    }
+    return result;
+}
+
+void SweepSizes(const std::string& name, int algorithm, const google::protobuf::MethodDescriptor* method) {
+    RpcCompressor::Options options;
+    options.algorithm = algorithm;
+    options.threshold = 0;
+    RpcCompressor compressor(options);
+
+    std::cout << "== " << name << " ==" << std::endl;
+    std::cout << std::setw(10) << "size" << std::setw(10) << "ratio" << std::setw(14) << "compress_us"
+              << std::setw(14) << "decompress_us" << std::setw(14) << "net_1G_us" << std::setw(14) << "net_10G_us"
+              << std::endl;
+
+    std::mt19937 rng(42);
+    // 收益为正且之后所有更大的长度也为正的最小长度；收益在更大的长度上又变为负时重新开始
+    size_t break_even[2] = {0, 0};
+    for (size_t size : kSizes) {
+        std::string payload = BuildPayload(size, &rng);
+        BenchResult result = RunBench(compressor, method, payload);
+        double net[2];
+        for (int i = 0; i < 2; ++i) {
+            double saved_us = payload.size() * (1 - result.ratio) * 8 / kLinks[i] * 1e6;
+            net[i] = saved_us - result.compress_us - result.decompress_us;
+            if (net[i] <= 0) {
+                break_even[i] = 0;
+            } else if (break_even[i] == 0) {
+                break_even[i] = size;
+            }
+        }
+        std::cout << std::fixed << std::setprecision(3)
+                  << std::setw(10) << size << std::setw(10) << result.ratio << std::setw(14) << result.compress_us
+                  << std::setw(14) << result.decompress_us << std::setw(14) << net[0] << std::setw(14) << net[1]
+                  << std::endl;
+    }
+    for (int i = 0; i < 2; ++i) {
+        std::cout << "break-even @" << kLinks[i] / 1e9 << "Gbps: ";
+        if (break_even[i] > 0) {
+            std::cout << ">= " << break_even[i] << " bytes (positive for every larger size up to "
+                      << kSizes[sizeof(kSizes) / sizeof(kSizes[0]) - 1] << ")" << std::endl;
+        } else {
+            std::cout << "not reached (no gain at the largest size)" << std::endl;
+        }
+    }
+    std::cout << std::endl;
+}
+
+// 小消息：不使用字典与使用按方法训练的字典的压缩率
+void CompareDictionary(const google::protobuf::MethodDescriptor* method) {
+    std::mt19937 rng(7);
+    std::vector<std::string> samples;
+    for (int i = 0; i < 2000; ++i) {
+        samples.push_back(BuildPayload(256, &rng));
+    }
+    std::string dictionary;
+    if (!RpcCompressor::TrainDictionary(samples, 16 * 1024, &dictionary)) {
+        std::cerr << "train dictionary failed!" << std::endl;
+        return;
+    }
+
+    RpcCompressor::Options plain_options;
+    plain_options.algorithm = rpcheader::COMPRESS_ZSTD;
+    plain_options.threshold = 0;
+    RpcCompressor plain(plain_options);
+
+    RpcCompressor::Options dict_options = plain_options;
+    dict_options.dictionary_threshold = 0;
+    dict_options.dictionaries[method->service()->name() + "." + method->name()] = dictionary;
+    RpcCompressor with_dict(dict_options);
+
+    std::cout << "== zstd dictionary (" << dictionary.size() << " bytes) ==" << std::endl;
+    std::cout << std::setw(10) << "size" << std::setw(14) << "ratio" << std::setw(14) << "ratio_dict"
+              << std::setw(14) << "compress_us" << std::setw(14) << "dict_us" << std::endl;
+    for (size_t size : {64, 128, 256, 512, 1024}) {
+        std::string payload = BuildPayload(size, &rng);
+        BenchResult a = RunBench(plain, method, payload);
+        BenchResult b = RunBench(with_dict, method, payload);
+        std::cout << std::fixed << std::setprecision(3)
+                  << std::setw(10) << size << std::setw(14) << a.ratio << std::setw(14) << b.ratio
+                  << std::setw(14) << a.compress_us << std::setw(14) << b.compress_us << std::endl;
+    }
+    std::cout << std::endl;
+}
+
+int main() {
+    const google::protobuf::MethodDescriptor* method =
+        fixbug::UserServiceRPC::descriptor()->FindMethodByName("Register");
+    uint32_t supported = RpcCompressor::SupportedMask();
+
+    struct Algorithm {
+        const char* name;
+        int type;
+    } algorithms[] = {
+        {"lz4", rpcheader::COMPRESS_LZ4},
+        {"zstd", rpcheader::COMPRESS_ZSTD},
+        {"zlib", rpcheader::COMPRESS_ZLIB},
+    };
+    for (const Algorithm& algorithm : algorithms) {
+        if (supported & (1u << algorithm.type)) {
+            SweepSizes(algorithm.name, algorithm.type, method);
+        } else {
+            std::cout << "== " << algorithm.name << ": not available ==" << std::endl << std::endl;
+        }
+    }
+    if (supported & (1u << rpcheader::COMPRESS_ZSTD)) {
+        CompareDictionary(method);
+    }
+    return 0;
+}
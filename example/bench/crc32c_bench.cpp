@@ -0,0 +1,63 @@
+/*
+ * 帧校验和基准测试
+ * 对不同长度的数据计算 CRC32C，分别统计硬件指令（SSE4.2 crc32，三路交错）与查表法（slicing-by-8）的吞吐量 (GB/s)，
+ * 以及单帧的校验耗时 (ns)，用于评估在生产环境中开启 rpc.checksum 的开销
+ *
+ * 用法: crc32c_bench
+ */
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <vector>
+#include "rpcchecksum.h"
+
+using Clock = std::chrono::steady_clock;
+
+static const size_t kSizes[] = {64, 256, 1024, 4096, 16 * 1024, 64 * 1024, 1024 * 1024};
+static const size_t kBytesPerRun = 512 * 1024 * 1024;  // 每种长度处理的数据总量
+
+using Kernel = uint32_t (*)(const void*, size_t, uint32_t);
+
+struct BenchResult {
+    double gbps = 0;        // 吞吐量 (GB/s)
+    double ns = 0;          // 单次计算耗时 (ns)
+};
+
+BenchResult RunBench(Kernel kernel, const std::vector<unsigned char>& data, size_t size) {
+    size_t reps = std::max<size_t>(1, kBytesPerRun / size);
+    uint32_t crc = 0;
+    auto start = Clock::now();
+    for (size_t i = 0; i < reps; ++i) {
+        crc = kernel(data.data(), size, crc);   // 依赖上一次的结果，避免被编译器优化掉
+    }
+    double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+    volatile uint32_t sink = crc;
+    (void)sink;
+
+    BenchResult result;
+    result.gbps = static_cast<double>(size) * reps / seconds / 1e9;
+    result.ns = seconds * 1e9 / reps;
+    return result;
+}
+
+int main() {
+    std::vector<unsigned char> data(kSizes[sizeof(kSizes) / sizeof(kSizes[0]) - 1]);
+    std::mt19937 rng(42);
+    for (unsigned char& c : data) {
+        c = static_cast<unsigned char>(rng());
+    }
+
+    std::cout << "hardware crc32c: " << (RpcChecksum::HardwareAccelerated() ? "sse4.2" : "not available") << std::endl;
+    std::cout << std::setw(10) << "size" << std::setw(14) << "hw_GB/s" << std::setw(14) << "hw_ns"
+              << std::setw(14) << "table_GB/s" << std::setw(14) << "table_ns" << std::endl;
+    for (size_t size : kSizes) {
+        BenchResult hw = RunBench(&RpcChecksum::Crc32c, data, size);
+        BenchResult table = RunBench(&RpcChecksum::Crc32cPortable, data, size);
+        std::cout << std::fixed << std::setprecision(2)
+                  << std::setw(10) << size << std::setw(14) << hw.gbps << std::setw(14) << hw.ns
+                  << std::setw(14) << table.gbps << std::setw(14) << table.ns << std::endl;
+    }
+    return 0;
+}
@@ -0,0 +1,211 @@
+/*
+ * 合并发送基准测试
+ * 在进程内启动 RpcProvider，多个客户端连接各自流水线发送请求（每轮 kDepth 个请求，收齐响应后再发下一轮），
+ * 分别在关闭、开启合并发送（rpc.write_coalescing）时统计：
+ * 1. 吞吐量 (req/s)
+ * 2. 服务端写操作次数（provider.write_calls，每次对应一次 writev 系统调用）
+ * 3. 平均每个响应的写操作次数
+ *
+ * 用法: write_coalescing_bench -i config.yaml（使用其中的 rpc.server_ip / rpc.server_port）
+ */
+
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <thread>
+#include <vector>
+#include <boost/asio.hpp>
+#include "rpcapplication.h"
+#include "rpcprovider.h"
+#include "rpcmetrics.h"
+#include "rpcheader.pb.h"
+#include "user.pb.h"
+
+static const int kConnections = 8;  // 客户端连接数
+static const int kRounds = 200;     // 每个连接的轮数
+static const int kDepth = 32;       // 每轮流水线发送的请求数
+
+// 只做最少工作的登录服务，使写路径成为主要开销
+class BenchUserService : public fixbug::UserServiceRPC {
+    public:
+        void Login(::google::protobuf::RpcController* controller,
+                   const ::fixbug::LoginRequest* request,
+                   ::fixbug::LoginResponse* response,
+                   ::google::protobuf::Closure* done) override {
+            response->mutable_result()->set_errcode(0);
+            response->set_success(true);
+            done->Run();
+        }
+};
+
+// 组装一轮流水线请求的字符流
+std::string BuildRequests() {
+    fixbug::LoginRequest request;
+    request.set_username("bench");
+    request.set_password("123456");
+    std::string args_str;
+    request.SerializeToString(&args_str);
+
+    std::string send_buf;
+    for (int i = 0; i < kDepth; ++i) {
+        rpcheader::RpcHeader header;
+        header.set_service_name("UserServiceRPC");
+        header.set_method_name("Login");
+        header.set_args_size(args_str.size());
+        header.set_request_id(i + 1);
+        std::string header_str;
+        header.SerializeToString(&header_str);
+
+        uint32_t header_size = htonl(header_str.size());
+        send_buf.append((char*)&header_size, 4);
+        send_buf.append(header_str);
+        send_buf.append(args_str);
+    }
+    return send_buf;
+}
+
+// 单个客户端连接：发送一轮请求，读取全部响应，重复 kRounds 轮；连接或读写失败时设置 failed
+void RunClient(const std::string& ip, uint16_t port, std::atomic<bool>* failed) {
+    try {
+        boost::asio::io_context io_context;
+        boost::asio::ip::tcp::socket socket(io_context);
+        socket.connect(boost::asio::ip::tcp::endpoint(boost::asio::ip::make_address(ip), port));
+
+        std::string send_buf = BuildRequests();
+        std::string header_str;
+        std::vector<char> body;
+        for (int round = 0; round < kRounds; ++round) {
+            boost::asio::write(socket, boost::asio::buffer(send_buf));
+            for (int i = 0; i < kDepth; ++i) {
+                uint32_t header_size = 0;
+                boost::asio::read(socket, boost::asio::buffer(&header_size, 4));
+                header_str.resize(ntohl(header_size));
+                boost::asio::read(socket, boost::asio::buffer(&header_str[0], header_str.size()));
+                rpcheader::RpcResponseHeader header;
+                header.ParseFromString(header_str);
+                body.resize(header.body_size());
+                boost::asio::read(socket, boost::asio::buffer(body));
+            }
+        }
+    } catch (const std::exception& e) {
+        std::cerr << "client failed: " << e.what() << std::endl;
+        failed->store(true);
+    }
+}
+
+// 检查端口当前没有被其他进程监听：否则下面的客户端会连到那个进程上，而 RpcProvider::Run 绑定失败后直接返回
+bool PortAvailable(const std::string& ip, uint16_t port, std::string* error) {
+    boost::asio::io_context io_context;
+    boost::asio::ip::tcp::acceptor acceptor(io_context);
+    boost::asio::ip::tcp::endpoint endpoint(boost::asio::ip::make_address(ip), port);
+    boost::system::error_code ec;
+    acceptor.open(endpoint.protocol(), ec);
+    if (!ec) {
+        acceptor.set_option(boost::asio::ip::tcp::acceptor::reuse_address(true), ec);
+        acceptor.bind(endpoint, ec);
+    }
+    if (ec) {
+        *error = ec.message();
+        return false;
+    }
+    return true;
+}
+
+// 等待服务端开始监听；Run 已经返回（绑定失败等）或超时时返回 false
+bool WaitForServer(const std::string& ip, uint16_t port, const std::atomic<bool>& run_exited) {
+    boost::asio::io_context io_context;
+    for (int i = 0; i < 100 && !run_exited.load(); ++i) {
+        boost::system::error_code ec;
+        boost::asio::ip::tcp::socket socket(io_context);
+        socket.connect(boost::asio::ip::tcp::endpoint(boost::asio::ip::make_address(ip), port), ec);
+        if (!ec) {
+            return !run_exited.load();
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    }
+    return false;
+}
+
+int main(int argc, char* argv[]) {
+    RpcApplication::Init(argc, argv);
+    std::string ip = RpcApplication::GetConfig().Load<std::string>("rpc.server_ip");
+    uint16_t port = RpcApplication::GetConfig().Load<int>("rpc.server_port");
+
+    std::atomic<int64_t>& write_calls = RpcMetrics::GetInstance().Counter("provider.write_calls");
+    std::atomic<int64_t>& write_responses = RpcMetrics::GetInstance().Counter("provider.write_responses");
+
+    std::cout << kConnections << " connections x " << kRounds << " rounds x " << kDepth << " pipelined requests" << std::endl;
+    std::cout << std::left << std::setw(14) << "coalescing"
+              << std::setw(14) << "req/s"
+              << std::setw(14) << "write_calls"
+              << std::setw(14) << "responses"
+              << std::setw(18) << "writes/response" << std::endl;
+
+    BenchUserService service;
+    for (bool coalescing : {false, true}) {
+        // 每种模式使用单独生成的配置文件
+        std::string config_file = "/tmp/write_coalescing_bench.yaml";
+        std::ofstream(config_file) << "rpc:\n"
+                                   << "  server_ip: \"" << ip << "\"\n"
+                                   << "  server_port: " << port << "\n"
+                                   << "  write_coalescing: " << (coalescing ? "true" : "false") << "\n";
+        RpcApplication::GetConfig().LoadConfigFile(config_file);
+
+        std::string error;
+        if (!PortAvailable(ip, port, &error)) {
+            std::cerr << "cannot listen on " << ip << ":" << port << ": " << error << std::endl;
+            return 1;
+        }
+
+        // 服务端的日志输出会干扰测量，运行期间丢弃标准输出
+        std::streambuf* cout_buf = std::cout.rdbuf(nullptr);
+        RpcProvider provider;
+        provider.NotifyService(&service);
+        std::atomic<bool> run_exited{false};
+        std::thread server([&provider, &run_exited]() {
+            provider.Run();
+            run_exited.store(true);
+        });
+        if (!WaitForServer(ip, port, run_exited)) {
+            provider.Stop();
+            server.join();
+            std::cout.rdbuf(cout_buf);
+            std::cerr << "provider failed to start on " << ip << ":" << port << std::endl;
+            return 1;
+        }
+
+        int64_t calls_before = write_calls.load();
+        int64_t responses_before = write_responses.load();
+        auto start = std::chrono::steady_clock::now();
+
+        std::atomic<bool> failed{false};
+        std::vector<std::thread> clients;
+        for (int i = 0; i < kConnections; ++i) {
+            clients.emplace_back(RunClient, ip, port, &failed);
+        }
+        for (auto& client : clients) {
+            client.join();
+        }
+
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        provider.Stop();
+        server.join();
+        std::cout.rdbuf(cout_buf);
+        std::cout.clear();
+        if (failed.load()) {
+            std::cerr << "benchmark aborted: client connections failed" << std::endl;
+            return 1;
+        }
+
+        int64_t calls = write_calls.load() - calls_before;
+        int64_t responses = write_responses.load() - responses_before;
+        std::cout << std::left << std::setw(14) << (coalescing ? "on" : "off")
+                  << std::setw(14) << std::fixed << std::setprecision(0) << responses / seconds
+                  << std::setw(14) << calls
+                  << std::setw(14) << responses
+                  << std::setw(18) << std::setprecision(3) << static_cast<double>(calls) / responses << std::endl;
+    }
+    return 0;
+}
@@ -10,11 +10,12 @@
 #include "user.pb.h"
 #include "rpcapplication.h"
 #include "rpcprovider.h"
+#include "rpcbatchservice.h"
 
 /*
  * UserService 原来是一个本地服务，提供了两个进程内的本地方法，Login和GetFriendLists
  */
-class UserService : public fixbug::UserServiceRPC {    // 使用在rpc服务发布端
+class UserService : public fixbug::UserServiceRPC, public RpcBatchService {    // 使用在rpc服务发布端
 public:
     bool Login(std::string name, std::string pwd) {
         std::cout << "UserService Local Login called!" << std::endl;
@@ -91,6 +92,41 @@ public:
 
         done->Run();
     }
+
+    // 批处理
+    /**
+     * @brief 实现 RpcBatchService::IsBatchMethod，Register 并发到达的请求由框架攒成一批后交给 CallMethodBatch
+     *        只对允许等待攒批的方法开启（Register 为 PRIORITY_BATCH）；延迟敏感的 Login 不攒批，
+     *        每个请求仍按调用方的公平队列和 PRIORITY_CRITICAL 调度
+     * @param method 方法描述符
+     * @return 按批处理返回 true
+     */
+    bool IsBatchMethod(const google::protobuf::MethodDescriptor* method) const override {
+        return method->name() == "Register";
+    }
+
+    /**
+     * @brief 实现 RpcBatchService::CallMethodBatch，一次处理一批 Register 请求
+     * @param method 方法描述符
+     * @param requests 一批 RegisterRequest
+     * @param responses 与 requests 一一对应的 RegisterResponse
+     * @param done 所有响应填充完毕后执行的回调
+     */
+    void CallMethodBatch(const google::protobuf::MethodDescriptor* method,
+                         const std::vector<const google::protobuf::Message*>& requests,
+                         const std::vector<google::protobuf::Message*>& responses,
+                         google::protobuf::Closure* done) override {
+        // 本地服务若支持批量写入（如一条 SQL 插入多个用户），在这里一次完成
+        for (size_t i = 0; i < requests.size(); ++i) {
+            auto request = static_cast<const fixbug::RegisterRequest*>(requests[i]);
+            auto response = static_cast<fixbug::RegisterResponse*>(responses[i]);
+            fixbug::ResultCode* code = response->mutable_result();
+            code->set_errcode(0);
+            code->set_errmsg("");
+            response->set_success(Register(request->id(), request->username(), request->password()));
+        }
+        done->Run();
+    }
 };
 
 
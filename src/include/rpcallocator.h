@@ -0,0 +1,234 @@
+#pragma once
+
+#include <cstddef>
+#include <mutex>
+#include <new>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief RpcHandlerMemory 异步操作回调的复用内存：一块固定大小的内存，同一时刻只供一个异步操作使用
+ *        asio 为每个异步操作分配保存回调的内存，通过回调关联的分配器（associated allocator）取得；
+ *        一条串行的操作链（如会话的连续读、连续写）上一个操作的内存总是在下一个操作分配前释放，
+ *        所以每条操作链一块内存即可，稳定运行时不再调用 malloc
+ *        内存正被占用或请求的长度超过 kSize 时退回到 operator new（计入 provider.handler_alloc_fallbacks）
+ *        线程安全：同一块内存上的分配/释放由操作链保证先后顺序，不能被多条并发的操作链共用
+ */
+class RpcHandlerMemory {
+    public:
+        static constexpr size_t kSize = 512;   // 可复用的最大长度，足以容纳读写回调及 strand 的包装
+
+        RpcHandlerMemory() = default;
+        RpcHandlerMemory(const RpcHandlerMemory&) = delete;
+        RpcHandlerMemory& operator=(const RpcHandlerMemory&) = delete;
+
+        /**
+         * @brief Allocate 分配回调内存
+         * @param size 长度
+         * @return 内存地址
+         */
+        void* Allocate(size_t size);
+
+        /**
+         * @brief Deallocate 释放回调内存
+         * @param pointer 由 Allocate 返回的地址
+         */
+        void Deallocate(void* pointer);
+
+    private:
+        alignas(std::max_align_t) unsigned char storage_[kSize];
+        bool inUse_ = false;    // storage_ 是否正被一个异步操作占用
+};
+
+/**
+ * @brief RpcHandlerAllocator 从 RpcHandlerMemory 分配内存的分配器，作为回调关联的分配器交给 asio
+ */
+template <typename T>
+class RpcHandlerAllocator {
+    public:
+        using value_type = T;
+
+        explicit RpcHandlerAllocator(RpcHandlerMemory& memory) noexcept : memory_(&memory) {}
+
+        template <typename U>
+        RpcHandlerAllocator(const RpcHandlerAllocator<U>& other) noexcept : memory_(other.memory_) {}
+
+        T* allocate(size_t n) { return static_cast<T*>(memory_->Allocate(sizeof(T) * n)); }
+
+        void deallocate(T* pointer, size_t /*n*/) { memory_->Deallocate(pointer); }
+
+        template <typename U>
+        bool operator==(const RpcHandlerAllocator<U>& other) const noexcept { return memory_ == other.memory_; }
+
+        template <typename U>
+        bool operator!=(const RpcHandlerAllocator<U>& other) const noexcept { return memory_ != other.memory_; }
+
+    private:
+        template <typename> friend class RpcHandlerAllocator;
+
+        RpcHandlerMemory* memory_;
+};
+
+/**
+ * @brief RpcAllocHandler 为回调关联 RpcHandlerAllocator 的包装（asio 通过 allocator_type / get_allocator 识别）
+ */
+template <typename Handler>
+class RpcAllocHandler {
+    public:
+        using allocator_type = RpcHandlerAllocator<Handler>;
+
+        RpcAllocHandler(RpcHandlerMemory& memory, Handler handler)
+            : memory_(memory), handler_(std::move(handler)) {}
+
+        allocator_type get_allocator() const noexcept { return allocator_type(memory_); }
+
+        template <typename... Args>
+        void operator()(Args&&... args) { handler_(std::forward<Args>(args)...); }
+
+    private:
+        RpcHandlerMemory& memory_;
+        Handler handler_;
+};
+
+/**
+ * @brief MakeAllocHandler 把回调包装为从 memory 分配内存的回调
+ * @param memory 回调内存（生命周期需长于异步操作，通常为持有 shared_ptr 的会话成员）
+ * @param handler 回调
+ * @return 包装后的回调
+ */
+template <typename Handler>
+inline RpcAllocHandler<std::decay_t<Handler>> MakeAllocHandler(RpcHandlerMemory& memory, Handler&& handler) {
+    return RpcAllocHandler<std::decay_t<Handler>>(memory, std::forward<Handler>(handler));
+}
+
+/**
+ * @brief RpcPageArena 各 slab 池（会话、读缓冲区）申请 slab 的内存来源
+ *        1. Off（默认）：每个 slab 单独通过 operator new 申请
+ *        2. Transparent：按 2MB 对齐申请 2MB 的区域并 madvise(MADV_HUGEPAGE)，由内核的透明大页合并为一个大页
+ *        3. HugeTlb：使用 MAP_HUGETLB 从预留的大页（vm.nr_hugepages）中申请区域，预留不足时退回 Transparent（计入 provider.huge_page_hugetlb_fallbacks，第一次退回时打印原因）
+ *        开启大页时多个 slab 依次排布在同一个区域中，分散的小缓冲区集中到少数大页上，减少 TLB 缺失；
+ *        区域与 slab 一样直到进程退出才归还系统；映射失败时退回 operator new（计入 provider.huge_page_fallbacks）
+ *        线程安全：可在任意线程调用，SetMode 应在第一次申请之前调用
+ */
+class RpcPageArena {
+    public:
+        enum class Mode {
+            Off,            // 普通页
+            Transparent,    // 透明大页
+            HugeTlb,        // 预留的大页
+        };
+
+        static constexpr size_t kRegionSize = 2 * 1024 * 1024;  // 区域长度，即一个大页
+
+        /**
+         * @brief SetMode 设置内存来源
+         * @param mode 内存来源
+         */
+        static void SetMode(Mode mode);
+
+        /**
+         * @brief ParseMode 解析配置中的名称（"off" / "thp" / "hugetlb"）
+         * @param name 名称
+         * @return 内存来源
+         */
+        static Mode ParseMode(const std::string& name);
+
+        /**
+         * @brief Allocate 申请一个 slab
+         * @param size 长度
+         * @param in_region 输出参数，是否位于大页区域中（区域中的 slab 不能用 operator delete 释放）
+         * @return 地址，按 alignof(std::max_align_t) 对齐
+         */
+        static void* Allocate(size_t size, bool* in_region);
+};
+
+/**
+ * @brief RpcSlabPool 定长内存块池：按 slab（一次分配 blocks_per_slab 个块）从 RpcPageArena 申请内存，
+ *        释放的块进入空闲链表复用，slab 直到对象池析构才归还系统
+ *        适合数量随连接数变化、创建销毁频繁的定长对象（如会话）
+ *        线程安全：Allocate / Deallocate 可在任意线程并发调用
+ */
+class RpcSlabPool {
+    public:
+        /**
+         * @brief 构造函数
+         * @param block_size 块长度（向上取整到 alignof(std::max_align_t)）
+         * @param blocks_per_slab 每个 slab 的块数
+         */
+        RpcSlabPool(size_t block_size, size_t blocks_per_slab);
+
+        /**
+         * @brief 析构函数：归还所有 slab，调用前所有块都应已释放
+         */
+        ~RpcSlabPool();
+
+        RpcSlabPool(const RpcSlabPool&) = delete;
+        RpcSlabPool& operator=(const RpcSlabPool&) = delete;
+
+        /**
+         * @brief Allocate 分配一个块，空闲链表为空时申请一个新的 slab
+         * @return 块地址
+         */
+        void* Allocate();
+
+        /**
+         * @brief Deallocate 释放一个块
+         * @param block 由 Allocate 返回的地址
+         */
+        void Deallocate(void* block);
+
+    private:
+        size_t blockSize_;
+        size_t blocksPerSlab_;
+        std::mutex mutex_;              // 保护 free_ 和 slabs_
+        std::vector<void*> free_;       // 空闲块
+        std::vector<void*> slabs_;      // 通过 operator new 申请的 slab（大页区域中的 slab 不单独释放）
+        size_t slabCount_ = 0;          // 已申请的 slab 数
+};
+
+/**
+ * @brief RpcSlabAllocator 从 RpcSlabPool 分配单个对象的分配器，用于 std::allocate_shared
+ *        （对象与 shared_ptr 的控制块在同一个块中），每种类型一个进程内共享的对象池
+ */
+template <typename T>
+class RpcSlabAllocator {
+    public:
+        using value_type = T;
+
+        static_assert(alignof(T) <= alignof(std::max_align_t), "over-aligned types are not supported");
+
+        RpcSlabAllocator() noexcept = default;
+
+        template <typename U>
+        RpcSlabAllocator(const RpcSlabAllocator<U>& /*other*/) noexcept {}
+
+        T* allocate(size_t n) {
+            if (n != 1) {
+                return static_cast<T*>(::operator new(sizeof(T) * n));
+            }
+            return static_cast<T*>(Pool().Allocate());
+        }
+
+        void deallocate(T* pointer, size_t n) {
+            if (n != 1) {
+                ::operator delete(pointer);
+                return;
+            }
+            Pool().Deallocate(pointer);
+        }
+
+        template <typename U>
+        bool operator==(const RpcSlabAllocator<U>& /*other*/) const noexcept { return true; }
+
+        template <typename U>
+        bool operator!=(const RpcSlabAllocator<U>& /*other*/) const noexcept { return false; }
+
+    private:
+        static RpcSlabPool& Pool() {
+            // 进程退出时不析构：析构顺序晚于对象池的对象（如 shared_ptr 仍被持有的会话）仍可归还内存
+            static RpcSlabPool* pool = new RpcSlabPool(sizeof(T), 64);
+            return *pool;
+        }
+};
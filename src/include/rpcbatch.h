@@ -0,0 +1,108 @@
+#pragma once
+
+#include <google/protobuf/service.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/descriptor.h>
+#include <string>
+#include <vector>
+#include "rpcchannel.h"
+#include "rpccontroller.h"
+
+/**
+ * @brief RpcBatch 批量调用
+ *        把多个rpc调用（可以属于同一服务端上的不同服务）组装成一个批量请求一次发送，
+ *        收到批量响应后一次完成所有调用，收发各只需一次系统调用，例如:
+ *        RpcBatch batch(channel);
+ *        batch.Add(method, &request, &response, &controller);
+ *        ...
+ *        batch.Send();   // 阻塞到所有调用完成
+ *        每个调用的结果通过各自的 response / controller 获取；
+ *        批量请求整体失败（如连接断开）时，所有调用的 controller 都被标记为失败；
+ *        批量请求不分块发送，所有子请求合计超过最大消息长度时整体失败（不影响同一连接上的其他调用）
+ */
+class RpcBatch {
+    public:
+        /**
+         * @brief 构造函数
+         * @param channel 发送批量请求的通道
+         */
+        explicit RpcBatch(RpcChannel* channel);
+
+        /**
+         * @brief Add 添加一个调用
+         * @param method 要调用的远程方法的描述信息
+         * @param request 请求消息，在 Send 返回前必须保持有效
+         * @param response 用于存储响应消息，在调用完成前必须保持有效
+         * @param controller 该调用的控制器，用于获取该调用的错误信息（可以为空）
+         */
+        void Add(const google::protobuf::MethodDescriptor* method,
+                 const google::protobuf::Message* request,
+                 google::protobuf::Message* response,
+                 google::protobuf::RpcController* controller = nullptr);
+
+        /**
+         * @brief SetTenant 设置批量请求的租户标识，没有单独设置租户的调用沿用该租户
+         * @param tenant 租户标识
+         */
+        void SetTenant(const std::string& tenant);
+
+        /**
+         * @brief Size 获取已添加的调用数
+         * @return 调用数
+         */
+        size_t Size() const { return items_.size(); }
+
+        /**
+         * @brief Send 发送批量请求
+         *        done 为空时阻塞到所有调用完成；否则立即返回，所有调用完成后执行 done，
+         *        此时 RpcBatch 对象在 done 执行前必须保持有效
+         * @param done 所有调用完成后的回调（可以为空）
+         */
+        void Send(google::protobuf::Closure* done = nullptr);
+
+        /**
+         * @brief Failed 批量请求是否整体失败（单个调用的失败通过各自的 controller 获取）
+         * @return 整体失败返回 true
+         */
+        bool Failed() const { return controller_.Failed(); }
+
+        /**
+         * @brief ErrorText 批量请求整体失败的原因
+         * @return 错误信息
+         */
+        std::string ErrorText() const { return controller_.ErrorText(); }
+
+        /**
+         * @brief Clear 清空已添加的调用及状态，以便复用
+         */
+        void Clear();
+
+    private:
+        /**
+         * @brief 批量请求中的一个调用
+         */
+        struct Item {
+            const google::protobuf::MethodDescriptor* method_;
+            const google::protobuf::Message* request_;
+            google::protobuf::Message* response_;
+            google::protobuf::RpcController* controller_;
+        };
+
+        /**
+         * @brief 解析批量响应的消息体：依次拼接的子响应字符流
+         * @param body 消息体
+         * @param size 消息体长度
+         * @return 失败原因，为空表示成功
+         */
+        std::string ParseResponses(const char* body, size_t size);
+
+        /**
+         * @brief 批量请求完成：整体失败时标记所有调用失败，然后执行 done
+         * @param done 所有调用完成后的回调（可以为空）
+         */
+        void Finish(google::protobuf::Closure* done);
+
+        RpcChannel* channel_;
+        std::vector<Item> items_;
+        RpcController controller_;      // 批量请求整体的状态及租户标识
+};
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <google/protobuf/service.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/descriptor.h>
+#include <vector>
+
+/**
+ * @brief RpcBatchService 服务端批处理接口（可选）
+ *        批量处理比逐个处理代价更低的方法（如查询数据库），服务对象可以同时继承该接口:
+ *        class UserService : public fixbug::UserServiceRPC, public RpcBatchService { ... };
+ *        对于 IsBatchMethod 返回 true 的方法，RpcProvider 把同一方法并发到达的请求攒成一批
+ *        （达到 batching.max_items 个或等待 batching.max_delay_us 微秒），通过 CallMethodBatch 一次交给服务，
+ *        服务填充所有响应后执行 done，框架再把各个响应分别发回各自的连接；
+ *        其他方法仍然通过 Service::CallMethod 逐个调用
+ */
+class RpcBatchService {
+    public:
+        virtual ~RpcBatchService() = default;
+
+        /**
+         * @brief IsBatchMethod 方法是否按批处理（在 NotifyService 时查询一次）
+         * @param method 方法描述符
+         * @return 按批处理返回 true
+         */
+        virtual bool IsBatchMethod(const google::protobuf::MethodDescriptor* method) const = 0;
+
+        /**
+         * @brief CallMethodBatch 批量执行一个方法
+         * @param method 方法描述符
+         * @param requests 一批请求消息
+         * @param responses 与 requests 一一对应的响应消息
+         * @param done 所有响应填充完毕后执行的回调
+         */
+        virtual void CallMethodBatch(const google::protobuf::MethodDescriptor* method,
+                                     const std::vector<const google::protobuf::Message*>& requests,
+                                     const std::vector<google::protobuf::Message*>& responses,
+                                     google::protobuf::Closure* done) = 0;
+};
@@ -0,0 +1,73 @@
+#pragma once
+
+#include <cstddef>
+
+/**
+ * @brief RpcBufferPool 按长度分级的读缓冲区池，代替每个会话各自持有的读缓冲区
+ *        1. 长度分为 4K、8K、16K、32K、64K 五级，申请的长度向上取整到所在级别（超过 64K 按 64K）
+ *        2. 每个线程每一级保留少量空闲缓冲区（thread_local，无锁），缓冲区在同一个IO回调中取出和归还，
+ *           所以每个IO线程每一级同一时刻最多占用一个；线程缓存不足或已满时从/向该级的 RpcSlabPool 取回/归还
+ *        会话只在套接字可读时取出缓冲区，读完立即归还，空闲连接不占用读缓冲区
+ *        线程安全：Acquire / Release 可在任意线程调用
+ */
+class RpcBufferPool {
+    public:
+        static constexpr size_t kMinSize = 4 * 1024;    // 最小一级的长度
+        static constexpr size_t kMaxSize = 64 * 1024;   // 最大一级的长度
+        static constexpr int kClasses = 5;              // 级数
+
+        /**
+         * @brief Buffer 从缓冲区池取出的缓冲区，析构时归还（只能移动）
+         */
+        class Buffer {
+            public:
+                Buffer() = default;
+                Buffer(Buffer&& other) noexcept;
+                Buffer& operator=(Buffer&& other) noexcept;
+                ~Buffer();
+
+                Buffer(const Buffer&) = delete;
+                Buffer& operator=(const Buffer&) = delete;
+
+                char* data() const { return data_; }
+                size_t size() const { return size_; }
+
+            private:
+                friend class RpcBufferPool;
+
+                Buffer(char* data, size_t size, int size_class) : data_(data), size_(size), class_(size_class) {}
+
+                char* data_ = nullptr;
+                size_t size_ = 0;
+                int class_ = -1;        // 所在级别，-1 表示空
+        };
+
+        /**
+         * @brief Acquire 取出一个缓冲区
+         * @param size 需要的长度
+         * @return 长度为 size 所在级别（不超过 kMaxSize）的缓冲区
+         */
+        static Buffer Acquire(size_t size);
+
+        /**
+         * @brief ClassSize 级别对应的缓冲区长度
+         * @param size_class 级别，0 到 kClasses - 1
+         * @return 缓冲区长度
+         */
+        static size_t ClassSize(int size_class) { return kMinSize << size_class; }
+
+        /**
+         * @brief ClassOf 长度所在的级别
+         * @param size 长度
+         * @return 不小于 size 的最小级别，超过 kMaxSize 时为最大一级
+         */
+        static int ClassOf(size_t size);
+
+    private:
+        /**
+         * @brief 归还缓冲区
+         * @param data 缓冲区地址
+         * @param size_class 级别
+         */
+        static void Release(char* data, int size_class);
+};
@@ -1,9 +1,29 @@
 #pragma once
 
 #include <google/protobuf/service.h>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include "rpcconnection.h"
 
+/**
+ * @brief RpcChannel 客户端调用通道
+ *        同一个 RpcChannel 上的所有调用（包括多个线程的并发调用、多个 Stub 共享同一个通道）
+ *        复用一条长连接，并发调用的请求会被合并到同一次写操作中发送
+ */
 class RpcChannel : public google::protobuf::RpcChannel {
     public:
+        /**
+         * @brief 使用配置文件中的 rpc.client.cork_us 作为合并等待窗口
+         */
+        RpcChannel();
+
+        /**
+         * @brief 指定合并等待窗口，适用于更看重吞吐量的通道
+         * @param cork_us 合并等待窗口（微秒），0 表示有请求就立即发送
+         */
+        explicit RpcChannel(int cork_us);
+
         // 重写基类的虚函数
         /**
          * @brief 通过RPC方式调用远程方法
@@ -13,11 +33,107 @@ class RpcChannel : public google::protobuf::RpcChannel {
          * @param controller 控制调用过程的控制器
          * @param request 包含调用参数的请求消息
          * @param response 用于存储从远程方法接收到的响应消息
-         * @param done 调用完成后的回调函数
+         * @param done 调用完成后的回调函数，为空时阻塞到调用完成；否则立即返回，调用完成后在连接的IO线程中执行
+         * @note 单向方法（.proto 中声明了 (rpcoptions.one_way)）在请求进入发送队列后立即完成，
+         *       response 保持不变；连接断开时尚未发出的单向请求会丢失（至多一次）
+         * @note 流式方法（.proto 中声明了 (rpcoptions.streaming)）要求 controller 为 RpcController，
+         *       CallMethod 立即返回，通过 controller->GetStream() 读写消息，调用结束后执行 done；
+         *       客户端流在 WritesDone 之后通过 GetStream()->Wait() 等待，最终的响应消息存储在 response 中
          */
         void CallMethod(const google::protobuf::MethodDescriptor* method,
                         google::protobuf::RpcController* controller,
                         const google::protobuf::Message* request,
                         google::protobuf::Message* response,
                         google::protobuf::Closure* done) override;
-};
\ No newline at end of file
+
+    private:
+        friend class RpcBatch;
+
+        /**
+         * @brief MethodRef 请求数据头中方法的表示方式
+         */
+        struct MethodRef {
+            MethodRef() : fixed(false), index(0), indexOnly(false) {}
+
+            bool fixed;         // 使用定长数据头（方法id）
+            uint32_t index;     // protobuf 数据头中附带的连接内序号（0 表示只带名字）
+            bool indexOnly;     // 序号已登记，只带序号不带名字
+        };
+
+        /**
+         * @brief 组装一个请求的字符流：数据头（两种格式见 rpcframe.h）+ 请求参数
+         * @param method 要调用的远程方法的描述信息
+         * @param controller 控制器，失败时通过它返回错误信息（可以为空），同时提供租户标识和元数据
+         * @param request 请求消息
+         * @param request_id 请求id
+         * @param credit 流式调用的初始接收窗口（非流式调用为 0）
+         * @param frame 输出参数，请求字符流追加到其末尾
+         * @param ref 方法的表示方式（批量请求的子请求总是使用带名字的 protobuf 数据头）
+         * @return 序列化失败返回 false
+         */
+        static bool SerializeRequest(const google::protobuf::MethodDescriptor* method,
+                                     google::protobuf::RpcController* controller,
+                                     const google::protobuf::Message* request,
+                                     uint64_t request_id,
+                                     uint32_t credit,
+                                     std::string* frame,
+                                     const MethodRef& ref = MethodRef());
+
+        /**
+         * @brief 组装请求帧的前半部分：数据头
+         * @param method 要调用的远程方法的描述信息
+         * @param controller 控制器，失败时通过它返回错误信息（可以为空），同时提供租户标识、超时时间和元数据
+         * @param request_id 请求id
+         * @param credit 流式调用的初始接收窗口（非流式调用为 0）
+         * @param args_size 数据头中的请求参数长度
+         * @param frame 输出参数，追加到其末尾
+         * @param compression 请求参数的压缩算法（0 表示未压缩）
+         * @param uncompressed_size 压缩前的请求参数长度
+         * @param ref 方法的表示方式
+         * @return 序列化失败返回 false
+         */
+        static bool EncodeRequestHeader(const google::protobuf::MethodDescriptor* method,
+                                        google::protobuf::RpcController* controller,
+                                        uint64_t request_id,
+                                        uint32_t credit,
+                                        size_t args_size,
+                                        std::string* frame,
+                                        int compression = 0,
+                                        size_t uncompressed_size = 0,
+                                        const MethodRef& ref = MethodRef());
+
+        /**
+         * @brief 把超过分块大小的请求参数组装成分块发送的帧（见 rpcchunk.h）
+         * @param method 要调用的远程方法的描述信息
+         * @param controller 控制器，失败时通过它返回错误信息（可以为空）
+         * @param request_id 请求id
+         * @param body 序列化（及压缩）后的请求参数
+         * @param compression 请求参数的压缩算法（0 表示未压缩）
+         * @param uncompressed_size 压缩前的请求参数长度
+         * @param fixed 是否使用定长数据头（分块请求不登记序号，总是带名字或方法id）
+         * @return 序列化失败返回空
+         */
+        std::unique_ptr<ChunkedFrame> BuildChunkedRequest(const google::protobuf::MethodDescriptor* method,
+                                                          google::protobuf::RpcController* controller,
+                                                          uint64_t request_id,
+                                                          std::string body,
+                                                          int compression,
+                                                          size_t uncompressed_size,
+                                                          bool fixed);
+
+        /**
+         * @brief 获取通道的连接，第一次调用时创建
+         * @return 连接
+         */
+        RpcConnection* GetConnection();
+
+        std::atomic<uint64_t> nextRequestId_{1};    // 下一个请求id
+        int corkUs_;                                // 合并等待窗口（微秒）
+        uint32_t streamWindow_;                     // 流式调用的接收窗口（消息数）
+        size_t chunkSize_;                          // 大请求的分块大小（0 表示不分块）
+        size_t maxMessageSize_;                     // 单个请求/响应消息的最大长度
+        bool checksum_;                             // 服务端支持时请求帧是否带 CRC32C 校验和
+        bool fixedHeader_;                          // 服务端支持时是否使用定长数据头（见 rpcframe.h）
+        std::once_flag connectionOnce_;
+        std::unique_ptr<RpcConnection> connection_; // 通道上所有调用共享的连接
+};
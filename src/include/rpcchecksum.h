@@ -0,0 +1,57 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+/**
+ * @brief RpcChecksum 帧校验和（CRC32C，Castagnoli 多项式）
+ *        开启 rpc.checksum 后，发送方在数据头中置标志位（protobuf 数据头为 header_size 的最高位，
+ *        定长数据头为 flags 中的 kFlagChecksum，见 rpcframe.h），
+ *        并在帧末尾追加 4字节（网络字节序）的 CRC32C，覆盖数据头及消息体；
+ *        接收方只要看到该标志就在反序列化之前校验，不要求双方同时开启；
+ *        发送方只对在握手中声明了支持校验和的对端发送（见 rpchandshake.h），旧版本的对端收到的帧不带校验和
+ *        1. 支持 SSE4.2 的 CPU 使用 crc32 指令，三路交错计算以隐藏指令延迟
+ *        2. 其他 CPU 使用查表法（slicing-by-8）
+ */
+class RpcChecksum {
+    public:
+        /**
+         * @brief header_size 中表示帧末尾带有校验和的标志位（数据头长度不会用到该位）
+         */
+        static constexpr uint32_t kFrameFlag = 0x80000000u;
+
+        /**
+         * @brief Crc32c 计算 CRC32C，按运行的 CPU 选择硬件指令或查表法
+         * @param data 数据
+         * @param size 数据长度
+         * @param crc 之前数据的 CRC32C，用于分段计算（第一段为 0）
+         * @return 拼接后数据的 CRC32C
+         */
+        static uint32_t Crc32c(const void* data, size_t size, uint32_t crc = 0);
+
+        /**
+         * @brief Crc32cPortable 只使用查表法计算 CRC32C（用于基准测试对比），参数同 Crc32c
+         */
+        static uint32_t Crc32cPortable(const void* data, size_t size, uint32_t crc = 0);
+
+        /**
+         * @brief HardwareAccelerated 当前 CPU 是否使用硬件指令计算
+         * @return 使用 SSE4.2 crc32 指令时返回 true
+         */
+        static bool HardwareAccelerated();
+
+        /**
+         * @brief Seal 为一个完整的帧加上校验和：置数据头中的标志位并追加 CRC32C
+         * @param frame 数据头 + 消息体
+         */
+        static void Seal(std::string* frame);
+
+        /**
+         * @brief Verify 校验一个带校验和的帧
+         * @param frame 帧（数据头中已置标志位）
+         * @param size 帧长度，包括末尾 4字节的校验和
+         * @return 校验和一致返回 true
+         */
+        static bool Verify(const char* frame, size_t size);
+};
@@ -0,0 +1,175 @@
+#pragma once
+
+#include <google/protobuf/message.h>
+#include <boost/asio/buffer.hpp>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @brief 大消息分块传输
+ *        消息体超过 chunk_size 的一元请求/响应拆成若干分块帧（FRAME_CHUNK）加一个最终帧发送：
+ *        分块帧的数据头只有 frame_type + request_id + 分块长度，最终帧的数据头与普通帧相同，消息体为最后一块；
+ *        1. 发送方只序列化一次，分块通过 scatter/gather 直接引用消息体，不再拷贝成完整的帧；
+ *           每次写操作最多发送一个分块，其余已就绪的小帧可以插在两个分块之间发送
+ *        2. 接收方的读缓冲区最多只需容纳一个分块，分块依次挂到缓冲区链上，
+ *           收到最终帧后直接从缓冲区链反序列化，不拼接成连续内存
+ */
+
+/**
+ * @brief ChunkedFrame 待分块发送的一个大帧（只在连接的写者中访问）
+ */
+class ChunkedFrame {
+    public:
+        /**
+         * @brief 构造函数
+         * @param chunk_header 分块帧的数据头（所有非最后的分块共用，两种格式见 rpcframe.h）
+         * @param final_header 最终帧的数据头（长度为最后一块的长度）
+         * @param body 完整的消息体
+         * @param chunk_size 分块大小
+         */
+        ChunkedFrame(std::string chunk_header, std::string final_header, std::string body, size_t chunk_size);
+
+        ChunkedFrame(const ChunkedFrame&) = delete;
+        ChunkedFrame& operator=(const ChunkedFrame&) = delete;
+
+        /**
+         * @brief EnableChecksum 每个分块帧都带上 CRC32C 校验和（见 rpcchecksum.h），需在第一次 Next 之前调用
+         */
+        void EnableChecksum();
+
+        /**
+         * @brief Next 取出下一个分块，其缓冲区在下一次调用 Next 或对象销毁前保持有效
+         * @param buffers 输出参数，分块的数据头及数据追加到其末尾
+         * @return 取出的是最终帧时返回 true
+         */
+        bool Next(std::vector<boost::asio::const_buffer>* buffers);
+
+        /**
+         * @brief Size 获取帧持有的内存长度（数据头及完整的消息体）
+         * @return 字节数
+         */
+        size_t Size() const { return chunkHeader_.size() + finalHeader_.size() + body_.size(); }
+
+        /**
+         * @brief LastChunkSize 计算最终帧携带的消息体长度
+         * @param body_size 消息体长度（大于 0）
+         * @param chunk_size 分块大小（大于 0）
+         * @return 最后一块的长度，取值范围 (0, chunk_size]
+         */
+        static size_t LastChunkSize(size_t body_size, size_t chunk_size);
+
+    private:
+        std::string chunkHeader_;
+        std::string finalHeader_;
+        std::string body_;
+        size_t chunkSize_;
+        size_t offset_ = 0;     // 下一块在 body_ 中的起始位置
+        bool checksum_ = false;
+        uint32_t chunkHeaderCrc_ = 0;   // 分块帧数据头的 CRC32C，每块在此基础上继续计算
+        uint32_t finalHeaderCrc_ = 0;
+        uint32_t trailer_ = 0;          // 当前分块的校验和（网络字节序）
+};
+
+/**
+ * @brief BufferChain 由若干分块组成的消息体
+ */
+class BufferChain {
+    public:
+        /**
+         * @brief Append 追加一个分块（拷贝）
+         * @param data 分块数据
+         * @param size 分块长度
+         */
+        void Append(const char* data, size_t size);
+
+        /**
+         * @brief Size 获取消息体总长度
+         * @return 总长度
+         */
+        size_t Size() const { return size_; }
+
+        /**
+         * @brief ParseTo 直接从缓冲区链反序列化消息
+         * @param message 用于存储消息
+         * @return 反序列化失败返回 false
+         */
+        bool ParseTo(google::protobuf::Message* message) const;
+
+        /**
+         * @brief Flatten 拼接成连续内存（用于需要随机访问消息体的情况）
+         * @param out 输出参数
+         */
+        void Flatten(std::string* out) const;
+
+    private:
+        std::vector<std::string> blocks_;
+        size_t size_ = 0;
+};
+
+/**
+ * @brief ChunkAssembler 一条连接上正在接收的分块消息，按 request_id 区分（只在连接的读者中访问）
+ */
+class ChunkAssembler {
+    public:
+        /**
+         * @brief 一个帧的组装结果
+         */
+        enum class Result {
+            kSingle,        // 不是分块消息，消息体就是最终帧的消息体
+            kAssembled,     // 分块消息已组装完整
+            kTooLarge,      // 分块消息超过最大消息长度，已丢弃
+        };
+
+        /**
+         * @brief 构造函数
+         * @param max_message_size 最大消息长度（字节）
+         */
+        explicit ChunkAssembler(size_t max_message_size) : maxMessageSize_(max_message_size) {}
+
+        /**
+         * @brief AddChunk 收到一个分块帧；超过最大消息长度时释放已接收的分块，之后的分块直接丢弃
+         * @param request_id 请求id
+         * @param data 分块数据
+         * @param size 分块长度
+         */
+        void AddChunk(uint64_t request_id, const char* data, size_t size);
+
+        /**
+         * @brief Finish 收到一个最终帧，取出该请求id上已接收的分块
+         * @param request_id 请求id
+         * @param data 最终帧的消息体
+         * @param size 最终帧的消息体长度
+         * @param chain 输出参数，结果为 kAssembled 时存储完整的消息体
+         * @return 组装结果
+         */
+        Result Finish(uint64_t request_id, const char* data, size_t size, BufferChain* chain);
+
+        /**
+         * @brief Clear 丢弃所有未完成的分块消息（连接断开）
+         */
+        void Clear() {
+            pending_.clear();
+            bytes_ = 0;
+        }
+
+        /**
+         * @brief Bytes 获取已接收、尚未组装完成的分块的总长度
+         * @return 字节数
+         */
+        size_t Bytes() const { return bytes_; }
+
+    private:
+        /**
+         * @brief 正在接收的分块消息
+         */
+        struct Pending {
+            BufferChain chain_;
+            bool tooLarge_ = false;
+        };
+
+        size_t maxMessageSize_;
+        std::unordered_map<uint64_t, Pending> pending_;
+        size_t bytes_ = 0;      // pending_ 中所有分块的总长度
+};
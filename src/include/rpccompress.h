@@ -0,0 +1,146 @@
+#pragma once
+
+#include <google/protobuf/descriptor.h>
+#include <atomic>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @brief RpcCompressor 消息体压缩
+ *        1. 算法：LZ4（速度优先）、Zstd（压缩率优先，可使用按方法训练的字典）、zlib；
+ *           编译时找到对应的库才会启用（RPC_HAVE_LZ4 / RPC_HAVE_ZSTD / RPC_HAVE_ZLIB）
+ *        2. 协商：连接建立时的握手携带双方能够解压的算法集合（见 rpchandshake.h），
+ *           握手完成后双方只使用对端支持的算法，此前的消息以及没有握手的对端不压缩
+ *        3. 只压缩达到阈值的消息体，压缩后没有变小时按原样发送；
+ *           配置了字典的方法使用更低的阈值，小而重复的消息也能获得较好的压缩率
+ *        线程安全：压缩/解压可在任意线程并发调用
+ */
+class RpcCompressor {
+    public:
+        /**
+         * @brief 压缩参数
+         */
+        struct Options {
+            int algorithm = 0;                  // 发送时使用的算法（rpcheader::CompressionType），0 表示不压缩
+            size_t threshold = 4096;            // 消息体达到该长度才压缩
+            int level = 1;                      // Zstd / zlib 的压缩级别
+            size_t dictionary_threshold = 64;   // 配置了字典的方法：消息体达到该长度即压缩
+            std::map<std::string, std::string> dictionaries;    // "Service.Method" 到 Zstd 字典内容的映射
+        };
+
+        /**
+         * @brief GetInstance 获取按配置文件（compression.*）创建的单例对象
+         * @return RpcCompressor& 单例对象引用
+         */
+        static RpcCompressor& GetInstance();
+
+        /**
+         * @brief 构造函数
+         * @param options 压缩参数（不支持的算法视为不压缩）
+         */
+        explicit RpcCompressor(const Options& options);
+        ~RpcCompressor();
+
+        RpcCompressor(const RpcCompressor&) = delete;
+        RpcCompressor& operator=(const RpcCompressor&) = delete;
+
+        /**
+         * @brief SupportedMask 本端能够解压的算法集合
+         * @return 按 1 << CompressionType 组成的位图，没有可用的压缩库时为 0
+         */
+        static uint32_t SupportedMask();
+
+        /**
+         * @brief ParseAlgorithm 解析算法名
+         * @param name "none" / "lz4" / "zstd" / "zlib"
+         * @return 算法（rpcheader::CompressionType），无法识别时返回 0
+         */
+        static int ParseAlgorithm(const std::string& name);
+
+        /**
+         * @brief WouldCompress 消息体是否可能被压缩（用于在序列化前决定是否走压缩路径）
+         * @param method 消息所属的方法
+         * @param size 消息体长度
+         * @param peer_mask 对端能够解压的算法集合
+         * @return 可能被压缩返回 true
+         */
+        bool WouldCompress(const google::protobuf::MethodDescriptor* method, size_t size, uint32_t peer_mask) const;
+
+        /**
+         * @brief Compress 压缩消息体；压缩后没有变小时保持原样
+         * @param method 消息所属的方法（用于查找字典）
+         * @param peer_mask 对端能够解压的算法集合
+         * @param body 输入输出参数，消息体
+         * @return 使用的算法，0 表示未压缩
+         */
+        int Compress(const google::protobuf::MethodDescriptor* method, uint32_t peer_mask, std::string* body) const;
+
+        /**
+         * @brief Decompress 解压消息体（Zstd 字典由帧中的字典id确定）
+         * @param algorithm 算法
+         * @param data 压缩后的消息体
+         * @param size 压缩后的长度
+         * @param uncompressed_size 压缩前的长度（由调用方检查上限）
+         * @param out 输出参数，解压后的消息体
+         * @return 算法不支持、数据损坏或长度不符时返回 false
+         */
+        bool Decompress(int algorithm, const char* data, size_t size, size_t uncompressed_size, std::string* out) const;
+
+        /**
+         * @brief TrainDictionary 用样本消息训练 Zstd 字典（需要 RPC_HAVE_ZSTD），
+         *        训练结果可以保存为文件并配置到 compression.dictionaries
+         * @param samples 样本消息（序列化后的消息体）
+         * @param capacity 字典的最大长度
+         * @param dictionary 输出参数，字典内容
+         * @return 训练失败（样本过少等）返回 false
+         */
+        static bool TrainDictionary(const std::vector<std::string>& samples, size_t capacity, std::string* dictionary);
+
+        /**
+         * @brief RegisterService 预先解析服务各方法的字典（服务端注册服务时调用），之后查找这些方法不再加锁
+         * @param service 服务描述符
+         */
+        void RegisterService(const google::protobuf::ServiceDescriptor* service);
+
+    private:
+        struct Dictionary;
+
+        // 方法描述符到字典的映射（没有字典的方法映射为空），发布后不再修改
+        using MethodDictionaries = std::unordered_map<const google::protobuf::MethodDescriptor*, const Dictionary*>;
+
+        /**
+         * @brief 选择压缩算法：配置了字典且对端支持 Zstd 时使用字典压缩，否则使用配置的算法
+         * @param method 消息所属的方法
+         * @param size 消息体长度
+         * @param peer_mask 对端能够解压的算法集合
+         * @param dictionary 输出参数，使用的字典（可以为空）
+         * @return 算法，0 表示不压缩
+         */
+        int Select(const google::protobuf::MethodDescriptor* method, size_t size, uint32_t peer_mask,
+                   const Dictionary** dictionary) const;
+
+        /**
+         * @brief 查找方法的字典：在当前发布的映射中无锁查找，未登记的方法（如客户端第一次调用）登记后再查找
+         * @param method 方法描述符
+         * @return 字典，没有配置时返回空
+         */
+        const Dictionary* FindDictionary(const google::protobuf::MethodDescriptor* method) const;
+
+        /**
+         * @brief 登记方法：复制当前映射并加入这些方法，发布为新的映射（加锁，每个方法只登记一次）
+         * @param methods 方法描述符
+         */
+        void AddMethods(const std::vector<const google::protobuf::MethodDescriptor*>& methods) const;
+
+        Options options_;
+        std::map<std::string, std::unique_ptr<Dictionary>> dictionaries_;          // 按 "Service.Method" 存放
+        std::unordered_map<uint32_t, const Dictionary*> dictionariesById_;       // 按字典id存放，用于解压
+        mutable std::mutex methodsMutex_;                                           // 保护 methodSnapshots_，串行化登记
+        mutable std::vector<std::unique_ptr<const MethodDictionaries>> methodSnapshots_;   // 发布过的映射（查找方可能仍在使用旧的映射，析构时才释放）
+        mutable std::atomic<const MethodDictionaries*> methods_{nullptr};          // 当前发布的映射
+};
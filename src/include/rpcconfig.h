@@ -58,9 +58,46 @@ class RpcConfig {
                 return node[last_part].as<T>();
             } catch (const YAML::Exception &e) {
                 throw std::runtime_error("Failed to convert config value for key: " + key + " - " + e.what());
-            } 
+            }
         }
-  
+
+        /**
+         * @brief Has 判断配置项是否存在
+         * @param key 配置项key，使用 "." 分隔层级，如 "limiter.enable"
+         * @return 存在返回 true，否则返回 false
+         */
+        bool Has(const std::string& key) const {
+            YAML::Node node = YAML::Clone(config_);
+
+            size_t start = 0;
+            size_t pos = 0;
+            do {
+                pos = key.find('.', start);
+                std::string part = key.substr(start, pos == std::string::npos ? std::string::npos : pos - start);
+                if (!node.IsMap() || !node[part]) {
+                    return false;
+                }
+                node = node[part];
+                start = pos + 1;
+            } while (pos != std::string::npos);
+
+            return true;
+        }
+
+        /**
+         * @brief Load 查询可选配置项，配置项不存在时返回默认值
+         * @param key 配置项key
+         * @param default_value 默认值
+         * @return 配置项value 或 default_value
+         */
+        template<typename T>
+        T Load(const std::string& key, const T& default_value) {
+            if (!Has(key)) {
+                return default_value;
+            }
+            return Load<T>(key);
+        }
+
     private:
         YAML::Node config_;
 };
\ No newline at end of file
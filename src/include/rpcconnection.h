@@ -0,0 +1,341 @@
+#pragma once
+
+#include <google/protobuf/service.h>
+#include <google/protobuf/message.h>
+#include <boost/asio.hpp>
+#include <atomic>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+#include "rpcstream.h"
+#include "rpcchunk.h"
+
+/**
+ * @brief RpcConnection 客户端到服务端的长连接
+ *        多个线程可以同时通过同一个连接发起调用：
+ *        1. 请求帧无锁地追加到发送队列（多生产者单消费者队列）
+ *        2. 连接的IO线程是唯一的写者，一次取出队列中的所有帧，通过一次 writev 发出
+ *        3. 开启 cork 后，写者被唤醒时先等待 cork_us 微秒，让更多并发调用的帧进入同一次写
+ *        4. 响应在IO线程中按 request_id 分发给对应的调用
+ *        5. 大请求分块发送，每次写操作最多附带一个分块；分块响应在IO线程中挂到缓冲区链上，收齐后再反序列化
+ *        6. 连接建立后先发送握手帧，收到服务端的握手回复后才启用它支持的优化（见 rpchandshake.h）
+ */
+class RpcConnection {
+    public:
+        /**
+         * @brief 连接参数
+         */
+        struct Options {
+            std::string ip;         // 服务端地址
+            uint16_t port = 0;      // 服务端端口
+            int cork_us = 0;        // 合并等待窗口（微秒），0 表示有帧就立即发送
+            size_t max_message_size = 64 * 1024 * 1024;    // 单个响应消息的最大长度
+            bool checksum = false;  // 服务端支持时发送的帧是否带 CRC32C 校验和（收到带校验和的帧时总是校验）
+        };
+
+        /**
+         * @brief 解析响应消息体的函数，返回值为失败原因，为空表示成功
+         */
+        using BodyParser = std::function<std::string(const char* body, size_t size)>;
+
+        explicit RpcConnection(const Options& options);
+        ~RpcConnection();
+
+        RpcConnection(const RpcConnection&) = delete;
+        RpcConnection& operator=(const RpcConnection&) = delete;
+
+        /**
+         * @brief Call 发送一个请求帧并等待其响应
+         *        done 为空时阻塞到调用完成；否则立即返回，调用完成后在IO线程中执行 done
+         * @param request_id 请求id（帧中携带的 request_id）
+         * @param frame 完整的请求帧
+         * @param response 用于存储响应消息
+         * @param controller 控制器，失败时通过它返回错误信息（可以为空）
+         * @param done 调用完成后的回调（可以为空）
+         * @param interned 请求数据头带有连接内序号时对应的方法（为空表示未使用序号）
+         * @param intern_epoch InternMethod 返回的登记轮次，入队时连接已断开或重连过则改为只带名字
+         */
+        void Call(uint64_t request_id,
+                  std::string frame,
+                  google::protobuf::Message* response,
+                  google::protobuf::RpcController* controller,
+                  google::protobuf::Closure* done,
+                  const google::protobuf::MethodDescriptor* interned = nullptr,
+                  uint64_t intern_epoch = 0);
+
+        /**
+         * @brief Call 分块发送一个大请求并等待其响应，其余同上
+         * @param request_id 请求id
+         * @param frame 待分块发送的请求
+         * @param response 用于存储响应消息
+         * @param controller 控制器，失败时通过它返回错误信息（可以为空）
+         * @param done 调用完成后的回调（可以为空）
+         */
+        void Call(uint64_t request_id,
+                  std::unique_ptr<ChunkedFrame> frame,
+                  google::protobuf::Message* response,
+                  google::protobuf::RpcController* controller,
+                  google::protobuf::Closure* done);
+
+        /**
+         * @brief Call 发送一个请求帧，响应消息体由 parser 解析（用于批量调用等响应不是单个消息的情况）
+         * @param request_id 请求id
+         * @param frame 完整的请求帧
+         * @param parser 响应状态为成功时用于解析响应消息体
+         * @param controller 控制器，失败时通过它返回错误信息（可以为空）
+         * @param done 调用完成后的回调（可以为空）
+         */
+        void Call(uint64_t request_id,
+                  std::string frame,
+                  BodyParser parser,
+                  google::protobuf::RpcController* controller,
+                  google::protobuf::Closure* done);
+
+        /**
+         * @brief CallStream 发起流式调用，立即返回
+         *        流中的消息交给 stream，最终的响应帧结束调用：先解析响应消息并通过 controller 报告错误，
+         *        再关闭 stream，最后执行 done
+         * @param request_id 请求id
+         * @param frame 完整的请求帧
+         * @param stream 消息流
+         * @param response 用于存储最终的响应消息（客户端流）
+         * @param controller 控制器，失败时通过它返回错误信息（可以为空）
+         * @param done 调用结束后的回调（可以为空）
+         * @param interned 同 Call
+         * @param intern_epoch 同 Call
+         */
+        void CallStream(uint64_t request_id,
+                        std::string frame,
+                        std::shared_ptr<RpcStream> stream,
+                        google::protobuf::Message* response,
+                        google::protobuf::RpcController* controller,
+                        google::protobuf::Closure* done,
+                        const google::protobuf::MethodDescriptor* interned = nullptr,
+                        uint64_t intern_epoch = 0);
+
+        /**
+         * @brief Send 只发送一个请求帧，不等待响应（用于单向请求）
+         * @param frame 完整的请求帧
+         * @param error 输出参数，失败原因
+         * @param interned 同 Call
+         * @param intern_epoch 同 Call
+         * @return 连接不可用返回 false；返回 true 表示请求帧已进入发送队列
+         */
+        bool Send(std::string frame, std::string* error,
+                  const google::protobuf::MethodDescriptor* interned = nullptr, uint64_t intern_epoch = 0);
+
+        /**
+         * @brief PeerCompression 服务端能够解压的算法集合（来自握手）
+         * @return 算法集合，尚未收到握手回复时为 0（不压缩）
+         */
+        uint32_t PeerCompression() const { return peerCompression_.load(std::memory_order_relaxed); }
+
+        /**
+         * @brief PeerFrameVersion 服务端支持的定长数据头版本（来自握手，见 rpcframe.h）
+         * @return 版本，尚未收到握手回复或服务端只支持 protobuf 数据头时为 0
+         */
+        uint32_t PeerFrameVersion() const { return peerFrameVersion_.load(std::memory_order_relaxed); }
+
+        /**
+         * @brief PeerMaxMessageSize 服务端能够接收的单个消息的最大长度（来自握手）
+         * @return 最大长度，尚未收到握手回复或服务端未声明时为 0
+         */
+        uint64_t PeerMaxMessageSize() const { return peerMaxMessageSize_.load(std::memory_order_relaxed); }
+
+        /**
+         * @brief PeerAmbiguousMethod 方法id在服务端是否哈希冲突（来自握手），冲突的方法不能使用定长数据头
+         * @param method 方法描述符
+         * @return 冲突返回 true；服务端没有冲突的方法时不加锁、不计算方法id
+         */
+        bool PeerAmbiguousMethod(const google::protobuf::MethodDescriptor* method) const;
+
+        /**
+         * @brief InternMethod 获取方法在连接上的序号（method_index），第一次调用该方法时分配
+         * @param method 方法描述符
+         * @param defined 输出参数，序号是否已登记：为 true 时请求只带序号，否则同时带名字和序号
+         * @param epoch 输出参数，分配时连接的登记轮次，传给 ConfirmMethod
+         * @return 序号，序号已用完时返回 0（只带名字）
+         */
+        uint32_t InternMethod(const google::protobuf::MethodDescriptor* method, bool* defined, uint64_t* epoch);
+
+        /**
+         * @brief ConfirmMethod 同时带名字和序号的请求帧已进入发送队列，之后入队的请求可以只带序号
+         *        （分块发送的请求可能晚于之后的小请求到达服务端，不能用于登记）
+         * @param method 方法描述符
+         * @param epoch InternMethod 返回的登记轮次，连接在此期间断开或重连过则忽略
+         */
+        void ConfirmMethod(const google::protobuf::MethodDescriptor* method, uint64_t epoch);
+
+    private:
+        /**
+         * @brief 发送队列中的一个请求帧（侵入式链表节点）
+         */
+        struct OutgoingFrame {
+            std::atomic<OutgoingFrame*> next_{nullptr};
+            std::string data_;
+            std::unique_ptr<ChunkedFrame> chunked_;     // 分块发送的大请求（此时 data_ 为空）
+            const google::protobuf::MethodDescriptor* interned_ = nullptr;  // 数据头带有连接内序号时对应的方法
+            uint64_t internEpoch_ = 0;                  // 分配序号时的登记轮次
+        };
+
+        /**
+         * @brief 等待响应的调用
+         */
+        struct PendingCall {
+            BodyParser parser_;             // 解析响应消息体
+            google::protobuf::RpcController* controller_;
+            google::protobuf::Closure* done_;
+            std::promise<void>* waiter_;    // 同步调用的等待者，异步调用时为空
+            std::shared_ptr<RpcStream> stream_; // 流式调用的消息流（一元调用为空）
+            google::protobuf::Message* response_ = nullptr; // 分块响应直接从缓冲区链解析到该消息（为空时拼接后交给 parser_）
+        };
+
+        /**
+         * @brief 发起调用：done 为空时阻塞到调用完成
+         * @param request_id 请求id
+         * @param frame 请求帧
+         * @param call 调用（waiter_ 由该函数设置）
+         */
+        void Invoke(uint64_t request_id, OutgoingFrame* frame, PendingCall call);
+
+        /**
+         * @brief 登记调用并发送请求帧，不等待响应
+         * @param request_id 请求id
+         * @param frame 请求帧，由该函数接管
+         * @param call 调用
+         */
+        void Start(uint64_t request_id, OutgoingFrame* frame, const PendingCall& call);
+
+        /**
+         * @brief 把请求帧加入发送队列并唤醒写者（开启校验和且服务端支持时先在调用线程中计算校验和）
+         *        带有连接内序号的帧在登记轮次已过期（连接在此期间断开或重连过）时改为只带名字
+         * @param frame 请求帧，由该函数接管
+         */
+        void Enqueue(OutgoingFrame* frame);
+
+        /**
+         * @brief 解析响应消息：压缩的消息体先解压，分块接收的消息体直接从缓冲区链解析
+         * @param call 调用
+         * @param compression 消息体的压缩算法（0 表示未压缩）
+         * @param uncompressed_size 压缩前的消息体长度
+         * @param body 最终帧的消息体（chain 不为空时忽略）
+         * @param size 最终帧的消息体长度
+         * @param chain 分块接收的完整消息体（可以为空）
+         * @return 失败原因，为空表示成功
+         */
+        std::string ParseResponse(const PendingCall& call, int compression, size_t uncompressed_size,
+                                  const char* body, size_t size, const BufferChain* chain) const;
+
+        /**
+         * @brief 将请求帧加入发送队列（多个线程可同时调用，无锁）
+         * @param frame 请求帧
+         */
+        void Push(OutgoingFrame* frame);
+
+        /**
+         * @brief 从发送队列取出一个请求帧（只能由写者调用）
+         * @return 请求帧；队列为空或队首的帧尚未链接完成时返回空
+         */
+        OutgoingFrame* Pop();
+
+        /**
+         * @brief 唤醒写者（已被唤醒时什么也不做）
+         */
+        void ScheduleWrite();
+
+        /**
+         * @brief 取出发送队列中的所有帧并发出（在IO线程中执行）
+         */
+        void DoWrite();
+
+        /**
+         * @brief 写操作结束后释放写者，若期间又有新帧则再次唤醒
+         */
+        void FinishWrite();
+
+        /**
+         * @brief 读取并分发响应（在IO线程中执行）
+         */
+        void DoRead();
+
+        /**
+         * @brief 确保连接已建立，必要时在IO线程中建立连接
+         * @param error 输出参数，失败原因
+         * @return 连接可用返回 true
+         */
+        bool EnsureConnected(std::string* error);
+
+        /**
+         * @brief 记录服务端握手回复中的能力（在IO线程中执行）
+         * @param body 握手帧的消息体
+         * @param size 消息体长度
+         * @return 消息体格式错误返回 false
+         */
+        bool OnHandshake(const char* body, size_t size);
+
+        /**
+         * @brief 连接断开：关闭套接字，所有未完成的调用以失败结束（在IO线程中执行）
+         * @param reason 失败原因
+         */
+        void Fail(const std::string& reason);
+
+        /**
+         * @brief 完成一次调用
+         * @param call 调用
+         * @param error 失败原因，为空表示成功
+         */
+        static void Complete(const PendingCall& call, const std::string& error);
+
+        Options options_;
+
+        boost::asio::io_context io_context_;
+        boost::asio::executor_work_guard<boost::asio::io_context::executor_type> work_;
+        boost::asio::ip::tcp::socket socket_;
+        boost::asio::steady_timer corkTimer_;
+        std::thread thread_;                        // 连接的IO线程
+
+        std::mutex connectMutex_;                   // 串行化建立连接
+        std::atomic<bool> connected_{false};
+        // 服务端在握手中声明的能力（重连后重新握手）
+        std::atomic<uint32_t> peerCompression_{0};  // 能够解压的算法集合
+        std::atomic<uint32_t> peerFrameVersion_{0}; // 支持的定长数据头版本
+        std::atomic<uint64_t> peerMaxMessageSize_{0};   // 能够接收的单个消息的最大长度
+        std::atomic<bool> peerChecksum_{false};     // 能够校验帧的校验和
+        std::atomic<bool> peerAmbiguous_{false};    // 是否有哈希冲突的方法id
+        mutable std::mutex ambiguousMutex_;         // 保护 peerAmbiguousIds_
+        std::vector<uint32_t> peerAmbiguousIds_;    // 哈希冲突的方法id（升序）
+
+        /**
+         * @brief 方法在连接上的序号
+         */
+        struct InternedMethod {
+            uint32_t index_;                        // 序号
+            bool defined_;                          // 登记帧是否已进入发送队列
+        };
+        std::mutex internMutex_;                    // 保护以下成员
+        std::unordered_map<const google::protobuf::MethodDescriptor*, InternedMethod> interned_;   // 断开或重连后清空
+        uint64_t internEpoch_ = 0;                  // 登记轮次，每次断开或重连加一
+
+        // 多生产者单消费者队列（Vyukov 侵入式队列）：生产者交换 head_，消费者独占 tail_
+        std::atomic<OutgoingFrame*> head_;
+        OutgoingFrame* tail_;
+        OutgoingFrame stub_;
+        std::atomic<int64_t> queuedFrames_{0};      // 已入队尚未取出的帧数
+        std::atomic<bool> writeScheduled_{false};   // 写者是否已被唤醒
+        std::vector<OutgoingFrame*> writing_;       // 正在发送的帧（只在IO线程中访问）
+        std::deque<std::unique_ptr<ChunkedFrame>> chunkedFrames_;  // 待分块发送的大请求（只在IO线程中访问）
+        std::unique_ptr<ChunkedFrame> chunkedWriting_;             // 正在发送其中一个分块的大请求
+
+        std::mutex pendingMutex_;
+        std::unordered_map<uint64_t, PendingCall> pending_;     // 等待响应的调用
+
+        std::vector<char> buffer_;                  // 读取数据缓冲区
+        std::string received_;                      // 已接收但尚未组成完整响应的数据
+        ChunkAssembler chunks_;                     // 正在接收的分块响应（只在IO线程中访问）
+};
@@ -1,10 +1,27 @@
 #pragma once
 
 #include <google/protobuf/service.h>
+#include <cstdint>
+#include <memory>
 #include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+#include "rpcstream.h"
 
+/**
+ * @brief RpcController 调用的控制器
+ *        元数据：请求和响应都可以携带一组 key-value（如调用链 id、租户、认证令牌、路由提示），
+ *        同一个 key 可以出现多次；在数据头的 metadata 字段中依次编码为
+ *        [varint key 长度][key][varint value 长度][value]，整块不超过 RpcFrame::kMaxMetadataSize
+ */
 class RpcController : public google::protobuf::RpcController {
     public:
+        /**
+         * @brief 对端发来的一条元数据，指向控制器持有的元数据缓冲区
+         */
+        using MetadataEntry = std::pair<std::string_view, std::string_view>;
+
         RpcController();
 
         /**
@@ -50,7 +67,91 @@ class RpcController : public google::protobuf::RpcController {
          */
         void NotifyOnCancel(google::protobuf::Closure* callback);
 
+        /**
+         * 客户端设置本次调用所属的租户，服务端按租户做公平调度
+         * @param tenant 租户标识，为空表示按连接调度
+         */
+        void SetTenant(const std::string& tenant);
+
+        /**
+         * 获取本次调用所属的租户
+         * @return 租户标识
+         */
+        const std::string& GetTenant() const;
+
+        /**
+         * 客户端设置本次调用的超时时间，随请求发送给服务端，服务端在执行前已超时的请求不再执行
+         * （返回 RPC_DEADLINE_EXCEEDED）；客户端本身不会因超时提前结束等待
+         * @param timeout_ms 超时时间（毫秒），0 表示不限（Reset 时保留）
+         */
+        void SetTimeout(uint32_t timeout_ms);
+
+        /**
+         * 获取本次调用的超时时间
+         * @return 超时时间（毫秒），0 表示不限
+         */
+        uint32_t GetTimeout() const;
+
+        /**
+         * 设置随本端消息发送的元数据：客户端在调用前设置，随请求发送；服务端在方法中设置，随成功的响应发送
+         * （Reset 时保留，通过 ClearMetadata 清空）
+         * @param key 键
+         * @param value 值
+         */
+        void SetMetadata(const std::string& key, const std::string& value);
+
+        /**
+         * 清空随本端消息发送的元数据
+         */
+        void ClearMetadata();
+
+        /**
+         * 获取对端发来的元数据：服务端为请求的元数据，客户端为响应的元数据（调用结束后获取）
+         * 返回值指向控制器持有的元数据缓冲区，不为每个 key 分配内存，在 Reset 或析构之前有效
+         * @param key 键
+         * @return 第一个匹配的值，不存在时返回空
+         */
+        std::string_view GetMetadata(std::string_view key) const;
+
+        /**
+         * 获取对端发来的所有元数据（按发送顺序），有效期同 GetMetadata
+         * @return 元数据
+         */
+        const std::vector<MetadataEntry>& GetAllMetadata() const;
+
+        /**
+         * 由框架在组装请求/响应时获取随本端消息发送的元数据
+         * @return 编码后的元数据，没有时为空
+         */
+        const std::string& OutgoingMetadata() const;
+
+        /**
+         * 由框架在收到请求/响应时设置对端发来的元数据
+         * @param block 数据头中编码后的元数据，由控制器接管，GetMetadata 返回的值指向其中
+         * @return 编码格式错误返回 false
+         */
+        bool SetIncomingMetadata(std::string block);
+
+        /**
+         * 获取流式调用的消息流
+         * 客户端在发起流式调用（CallMethod 返回）后获取，服务端在流式方法中获取
+         * @return 消息流，非流式调用返回 nullptr
+         */
+        RpcStream* GetStream() const;
+
+        /**
+         * 由框架在发起/执行流式调用时设置消息流
+         * @param stream 消息流
+         */
+        void SetStream(std::shared_ptr<RpcStream> stream);
+
     private:
         bool failed_ = false;   // RPC 方法执行过程中的状态
         std::string errText_ = ""; // 错误信息
+        std::string tenant_;    // 租户标识（Reset 时保留）
+        uint32_t timeoutMs_ = 0;    // 超时时间（Reset 时保留）
+        std::shared_ptr<RpcStream> stream_; // 流式调用的消息流
+        std::string metadataOut_;   // 随本端消息发送的元数据（已编码，Reset 时保留）
+        std::string metadataIn_;    // 对端发来的元数据缓冲区
+        std::vector<MetadataEntry> metadataEntries_;    // 指向 metadataIn_ 的元数据
 };
\ No newline at end of file
@@ -0,0 +1,213 @@
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @brief CodelDetector 基于 CoDel 的排队时延过载检测
+ *        每个 interval 内记录请求排队时间（sojourn）的最小值：
+ *        若整个 interval 内的最小排队时间都高于 target，说明队列一直没有被排空（持续排队而非突发），判定为过载
+ *        过载期间，排队时间超过 2 * target 的请求视为已经过期，应当丢弃而不是继续执行
+ */
+class CodelDetector {
+    public:
+        /**
+         * @brief 构造函数
+         * @param target 可接受的排队时间
+         * @param interval 判断是否过载的观察窗口
+         */
+        CodelDetector(std::chrono::steady_clock::duration target, std::chrono::steady_clock::duration interval);
+
+        /**
+         * @brief ShouldDrop 提交一次排队时间样本，并判断该请求是否应被丢弃（调用方需保证串行调用）
+         * @param sojourn 请求的排队时间
+         * @param now 当前时间
+         * @return 处于过载状态且请求排队时间超过 2 * target 时返回 true
+         */
+        bool ShouldDrop(std::chrono::steady_clock::duration sojourn, std::chrono::steady_clock::time_point now);
+
+        /**
+         * @brief IsOverloaded 当前是否处于过载状态
+         * @return 过载返回 true
+         */
+        bool IsOverloaded() const { return overloaded_; }
+
+    private:
+        std::chrono::steady_clock::duration target_;
+        std::chrono::steady_clock::duration interval_;
+        std::chrono::steady_clock::time_point interval_end_;    // 当前观察窗口的结束时间
+        std::chrono::steady_clock::duration min_sojourn_;       // 当前窗口内的最小排队时间
+        bool overloaded_ = false;
+};
+
+/**
+ * @brief RpcExecutor rpc方法的执行线程池
+ *        IO线程负责读取和解码请求，解码完成后打上时间戳投递到执行队列，由工作线程执行服务方法
+ *        执行队列先按方法的优先级划分为 critical / normal / batch 三类，类之间按严格优先级或加权轮转调度；
+ *        每一类中再按流（flow，即连接或租户）划分，工作线程以加权赤字轮转（DRR）的方式从各个流中取任务，
+ *        每轮每个流获得 weight 个任务的额度，一个请求量很大的流不会让其他流的请求一直排在它后面
+ *        开启 CoDel 后，每个流独立测量任务的排队时间，过载时丢弃该流的过期任务（执行其 shed 回调）
+ */
+class RpcExecutor {
+    public:
+        /**
+         * @brief 过载时的出队策略
+         */
+        enum class ShedMode {
+            DropOldest,     // 先进先出，过载时丢弃队首的过期任务
+            Lifo,           // 过载时改为后进先出，优先服务最新的任务，队首的过期任务被丢弃
+        };
+
+        /**
+         * @brief 任务的优先级，数值越小越优先
+         */
+        enum class Priority {
+            Critical = 0,   // 延迟敏感
+            Normal = 1,     // 普通
+            Batch = 2,      // 批量/后台
+        };
+        static const int kPriorityCount = 3;
+
+        /**
+         * @brief 执行器参数
+         */
+        struct Options {
+            int threads = 4;                    // 工作线程数
+            bool codel_enable = false;          // 是否开启 CoDel 排队时延准入控制
+            int codel_target_ms = 5;            // 可接受的排队时间（毫秒）
+            int codel_interval_ms = 100;        // 过载判断的观察窗口（毫秒）
+            ShedMode shed_mode = ShedMode::DropOldest;
+            bool fair_queue_enable = true;      // 是否按流公平调度，关闭时所有任务进入同一个先进先出队列
+            std::map<std::string, double> flow_weights; // 各个流的权重，未配置的流权重为 1
+            bool priority_strict = false;       // 优先级之间是否严格优先，否则按 priority_weights 加权轮转
+            double priority_weights[kPriorityCount] = {8, 4, 1};    // 各优先级每轮获得的额度
+        };
+
+        explicit RpcExecutor(const Options& options);
+        ~RpcExecutor();
+
+        RpcExecutor(const RpcExecutor&) = delete;
+        RpcExecutor& operator=(const RpcExecutor&) = delete;
+
+        /**
+         * @brief Submit 投递一个任务，任务的入队时间即为当前时间
+         * @param priority 任务的优先级
+         * @param flow 任务所属的流（租户标识或连接标识）
+         * @param run 执行任务的回调
+         * @param shed 任务因过载被丢弃时执行的回调（在工作线程中执行；执行器停止时在调用 Stop / Submit 的线程中执行）
+         */
+        void Submit(Priority priority, const std::string& flow, std::function<void()> run, std::function<void()> shed);
+
+        /**
+         * @brief Stop 停止执行器：等待工作线程退出，尚未执行的任务按过载丢弃（执行其 shed 回调）
+         *        停止后投递的任务直接执行其 shed 回调
+         */
+        void Stop();
+
+        /**
+         * @brief GetQueueSize 获取当前排队的任务数
+         * @return 排队任务数
+         */
+        size_t GetQueueSize() const;
+
+        /**
+         * @brief ParseShedMode 解析配置中的出队策略名称（"drop_oldest" / "lifo"）
+         * @param name 策略名称
+         * @return 出队策略
+         */
+        static ShedMode ParseShedMode(const std::string& name);
+
+        /**
+         * @brief ParsePriority 解析配置中的优先级名称（"critical" / "normal" / "batch"）
+         * @param name 优先级名称
+         * @return 优先级
+         */
+        static Priority ParsePriority(const std::string& name);
+
+    private:
+        /**
+         * @brief 排队中的任务
+         */
+        struct Task {
+            std::function<void()> run_;
+            std::function<void()> shed_;
+            std::chrono::steady_clock::time_point enqueue_;     // 入队时间
+        };
+
+        /**
+         * @brief 一个流的任务队列及其调度状态
+         */
+        struct Flow {
+            Flow(const std::string& key, double weight, const Options& options);
+
+            std::string key_;
+            double weight_;             // 每轮获得的额度
+            double deficit_ = 0;        // 剩余额度，每执行一个任务消耗 1
+            std::deque<Task> queue_;
+            CodelDetector codel_;       // 该流的排队时延检测
+            bool active_ = false;       // 是否在轮转队列中（有任务排队）
+            std::chrono::steady_clock::time_point idleSince_;  // 最近一次排空的时间
+        };
+
+        /**
+         * @brief 一个优先级的执行队列
+         */
+        struct PriorityQueue {
+            // 最近有任务的流；排空后保留 kFlowIdleIntervals 个 CoDel 窗口，连续的突发共用同一个 CoDel 状态
+            std::unordered_map<std::string, std::unique_ptr<Flow>> flows_;
+            std::deque<Flow*> activeFlows_;     // DRR 轮转队列，队首为当前正在服务的流
+            size_t queued_ = 0;                 // 该优先级排队的任务数
+            double deficit_ = 0;                // 加权轮转模式下该优先级的剩余额度
+        };
+
+        /**
+         * @brief 按优先级选出下一个要执行的任务（需持有锁）
+         * @param task 输出参数，选出的任务
+         * @param shed_tasks 输出参数，选取过程中因过载被丢弃的任务
+         * @return 选出任务返回 true，所有队列都为空时返回 false
+         */
+        bool PickTask(Task* task, std::vector<Task>* shed_tasks);
+
+        /**
+         * @brief 在一个优先级的队列中按 DRR 选出下一个要执行的任务（需持有锁）
+         * @param queue 优先级队列
+         * @param task 输出参数，选出的任务
+         * @param shed_tasks 输出参数，选取过程中因过载被丢弃的任务
+         * @return 选出任务返回 true，该优先级的所有流都为空时返回 false
+         */
+        bool PickFromQueue(PriorityQueue& queue, Task* task, std::vector<Task>* shed_tasks);
+
+        /**
+         * @brief 释放空闲超过保留时间的流（需持有锁）
+         * @param now 当前时间
+         */
+        void ReapIdleFlows(std::chrono::steady_clock::time_point now);
+
+        /**
+         * @brief 工作线程主循环
+         */
+        void WorkerLoop();
+
+        static constexpr int kFlowIdleIntervals = 10;  // 排空的流保留的 CoDel 窗口数（至少 1 秒）
+
+        Options options_;
+
+        mutable std::mutex mutex_;
+        std::condition_variable cond_;
+        PriorityQueue queues_[kPriorityCount];  // 按优先级划分的执行队列
+        int current_ = 0;                   // 加权轮转模式下当前服务的优先级
+        std::chrono::steady_clock::duration flowIdle_;      // 排空的流的保留时间
+        std::chrono::steady_clock::time_point nextReap_;    // 下次检查空闲流的时间
+        size_t queued_ = 0;                 // 排队任务总数
+        bool stopped_ = false;
+        std::vector<std::thread> workers_;
+};
@@ -0,0 +1,107 @@
+#pragma once
+
+#include <google/protobuf/descriptor.h>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include "rpcheader.pb.h"
+
+/**
+ * @brief RpcFrame 帧数据头的编解码，两种格式按帧的第一个字节区分
+ *        1. protobuf 数据头：4字节 header_size（网络字节序）+ RpcHeader / RpcResponseHeader + 消息体；
+ *           header_size 不超过 kMaxHeaderSize，第一个字节只能是 0x00 或 0x80（带校验和，见 rpcchecksum.h）
+ *        2. 定长数据头（kVersion）：32字节，网络字节序，几次定长读取即可解码，不分配内存
+ *             偏移  长度  字段
+ *             0     2     magic（0xA752）
+ *             2     1     version
+ *             3     1     frame_type
+ *             4     2     flags：bit0 单向请求，bit1 帧末尾带校验和，bit2-3 消息体的压缩算法
+ *             6     2     status（响应状态，请求中为 0）
+ *             8     8     request_id
+ *             16    4     method_id（请求，"包名.服务名.方法名" 的 CRC32C）
+ *             20    4     timeout_ms（请求，调用的剩余时间）
+ *             24    4     body_size
+ *             28    4     ext_size（紧随其后的扩展数据头长度）
+ *           扩展数据头是只含不常用字段（租户、授信、批量、压缩前长度、错误信息、元数据）的 RpcHeader / RpcResponseHeader，
+ *           常见的请求和响应中为空；服务名、方法名及压缩协商字段不出现在定长数据头的帧中
+ *        兼容：服务端在握手回复中表明支持的版本（见 rpchandshake.h），客户端此后才发送定长数据头；
+ *        服务端按客户端使用的格式回复，旧版本的客户端只会收到 protobuf 数据头
+ *        名字登记：不使用定长数据头时，客户端第一次调用某个方法时同时发送名字和连接内的序号（method_index），
+ *        登记帧进入发送队列之后的请求只带序号，服务端把序号直接映射到已查找好的方法
+ */
+class RpcFrame {
+    public:
+        static constexpr uint16_t kMagic = 0xA752;
+        static constexpr uint8_t kVersion = 1;              // 定长数据头的版本
+        static constexpr size_t kFixedHeaderSize = 32;      // 定长数据头的长度
+        static constexpr uint32_t kMaxHeaderSize = 64 * 1024;   // protobuf 数据头及扩展数据头的最大长度
+        static constexpr uint32_t kMaxMethodIndex = 1024;       // 一条连接上登记的方法序号（method_index）上限
+        static constexpr size_t kMaxMetadataSize = 16 * 1024;   // 请求/响应元数据（见 rpccontroller.h）编码后的最大长度
+
+        static constexpr uint16_t kFlagOneWay = 1 << 0;
+        static constexpr uint16_t kFlagChecksum = 1 << 1;
+        static constexpr int kCompressionShift = 2;
+        static constexpr uint16_t kCompressionMask = 3 << kCompressionShift;
+
+        /**
+         * @brief 解码结果
+         */
+        enum class Result {
+            kOk,            // 数据头解码完成
+            kIncomplete,    // 数据头还未接收完整
+            kError,         // 格式错误（连接应被关闭）
+        };
+
+        /**
+         * @brief 解码得到的帧信息（数据头之外的部分）
+         */
+        struct FrameInfo {
+            size_t header_bytes = 0;    // 消息体之前的字节数（含 header_size 或定长数据头及扩展数据头）
+            bool fixed = false;         // 是否为定长数据头
+            bool checksum = false;      // 帧末尾是否带 4字节校验和
+        };
+
+        /**
+         * @brief MethodId 计算方法id
+         * @param method 方法描述符
+         * @return "包名.服务名.方法名" 的 CRC32C
+         */
+        static uint32_t MethodId(const google::protobuf::MethodDescriptor* method);
+
+        /**
+         * @brief AppendRequestHeader 编码请求数据头，追加到 frame 末尾（消息体由调用方追加）
+         * @param header 请求数据头
+         * @param fixed 是否使用定长数据头（此时使用 method_id，忽略服务名和方法名）
+         * @param frame 输出参数
+         */
+        static void AppendRequestHeader(const rpcheader::RpcHeader& header, bool fixed, std::string* frame);
+
+        /**
+         * @brief AppendResponseHeader 编码响应数据头，追加到 frame 末尾（消息体由调用方追加）
+         * @param header 响应数据头
+         * @param fixed 是否使用定长数据头
+         * @param frame 输出参数
+         */
+        static void AppendResponseHeader(const rpcheader::RpcResponseHeader& header, bool fixed, std::string* frame);
+
+        /**
+         * @brief ParseRequestHeader 解码请求数据头（两种格式）
+         * @param data 字符流
+         * @param size 字符流长度
+         * @param header 输出参数，请求数据头（定长数据头中的字段也填入其中）
+         * @param info 输出参数，帧信息
+         * @return 解码结果
+         */
+        static Result ParseRequestHeader(const char* data, size_t size, rpcheader::RpcHeader* header, FrameInfo* info);
+
+        /**
+         * @brief ParseResponseHeader 解码响应数据头（两种格式），参数同上
+         */
+        static Result ParseResponseHeader(const char* data, size_t size, rpcheader::RpcResponseHeader* header, FrameInfo* info);
+
+        /**
+         * @brief MarkChecksum 在帧的数据头中标记帧末尾带有校验和
+         * @param frame 帧的起始位置
+         */
+        static void MarkChecksum(char* frame);
+};
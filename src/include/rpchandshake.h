@@ -0,0 +1,61 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * @brief RpcHandshake 连接建立时的能力协商
+ *        1. 客户端在连接建立后立即发送握手帧（protobuf 数据头，frame_type 为 FRAME_HANDSHAKE，消息体为 Handshake），
+ *           不等待回复，之后的请求照常入队
+ *        2. 服务端记录客户端的能力并回复自己的能力；双方只对声明了支持的对端启用对应的优化：
+ *           压缩（只使用对端能够解压的算法）、校验和、定长数据头和方法序号（客户端）、消息长度上限
+ *        3. 兼容：旧版本的服务端丢弃不认识的帧类型、不回复，旧版本的客户端不发送握手帧，
+ *           此时双方一直使用基本协议（带名字的 protobuf 数据头、不压缩、不带校验和）；
+ *           握手回复到达之前的请求同样使用基本协议
+ */
+class RpcHandshake {
+    public:
+        /**
+         * @brief 一端支持的能力（对应 rpcheader.proto 中的 Handshake，未收到握手时全为 0）
+         */
+        struct Capabilities {
+            uint32_t version = 0;           // 定长数据头版本（见 rpcframe.h），非 0 时同时支持 method_index
+            uint32_t compression = 0;       // 能够解压的算法集合（按 1 << CompressionType 的位图）
+            uint64_t max_message_size = 0;  // 能够接收的单个消息的最大长度，0 表示未声明
+            bool multiplexing = false;      // 同一连接上的请求可以同时进行，响应按 request_id 乱序返回
+            bool checksum = false;          // 能够校验帧末尾的 CRC32C 校验和
+            std::vector<uint32_t> ambiguous_method_ids; // 服务端哈希冲突的方法id（升序），这些方法只能按名字调用
+        };
+
+        /**
+         * @brief Local 本端的能力
+         * @param max_message_size 本端能够接收的单个消息的最大长度
+         * @return 能力
+         */
+        static Capabilities Local(size_t max_message_size);
+
+        /**
+         * @brief BuildRequest 组装客户端发送的握手帧
+         * @param capabilities 客户端的能力
+         * @return 帧
+         */
+        static std::string BuildRequest(const Capabilities& capabilities);
+
+        /**
+         * @brief BuildResponse 组装服务端回复的握手帧
+         * @param capabilities 服务端的能力
+         * @return 帧
+         */
+        static std::string BuildResponse(const Capabilities& capabilities);
+
+        /**
+         * @brief Parse 解析握手帧的消息体
+         * @param body 消息体
+         * @param size 消息体长度
+         * @param capabilities 输出参数，对端的能力
+         * @return 消息体格式错误返回 false
+         */
+        static bool Parse(const char* body, size_t size, Capabilities* capabilities);
+};
@@ -0,0 +1,84 @@
+#pragma once
+
+#include <chrono>
+#include <mutex>
+
+/**
+ * @brief ConcurrencyLimiter 自适应并发限制器（gradient 算法）
+ *        根据测得的 RTT 动态调整允许的在途请求数（inflight）上限：
+ *        1. 记录无负载时的最小 RTT（rtt_noload）作为基准
+ *        2. 每个采样窗口结束时计算窗口平均 RTT（sample_rtt）
+ *        3. gradient = clamp(rtt_noload * tolerance / sample_rtt, 0.5, 1.0)
+ *        4. new_limit = limit * gradient + queue_size（queue_size = sqrt(limit)，用于探测更高的并发）
+ *        5. limit 按 smoothing 平滑后夹在 [min_limit, max_limit] 之间
+ *        RTT 上升说明请求开始排队，gradient < 1，limit 随之收缩；RTT 回落时 limit 以 sqrt(limit) 的步长增长
+ *        请求超过 limit 时 TryAcquire 立即失败，由调用方直接拒绝请求，而不是让请求排队
+ */
+class ConcurrencyLimiter {
+    public:
+        /**
+         * @brief 限制器参数
+         */
+        struct Options {
+            int initial_limit = 20;             // 初始并发上限
+            int min_limit = 1;                  // 并发上限的下界
+            int max_limit = 1000;               // 并发上限的上界
+            double smoothing = 0.2;             // limit 的平滑系数，越大调整越激进
+            double tolerance = 1.5;             // 可容忍的 RTT 膨胀倍数，低于该倍数视为无排队
+            int window_ms = 100;                // 采样窗口时长（毫秒）
+            int window_min_samples = 10;        // 一个窗口至少需要的样本数
+            int noload_reset_windows = 100;     // 每隔多少个窗口重新测量 rtt_noload，避免基准长期失效
+        };
+
+        explicit ConcurrencyLimiter(const Options& options);
+
+        /**
+         * @brief TryAcquire 尝试占用一个并发名额
+         * @return 在途请求数未达到上限时返回 true；否则返回 false，请求应被拒绝
+         */
+        bool TryAcquire();
+
+        /**
+         * @brief Release 归还并发名额，并提交一次 RTT 样本
+         * @param rtt 请求从获得名额到完成的耗时
+         */
+        void Release(std::chrono::steady_clock::duration rtt);
+
+        /**
+         * @brief Cancel 归还并发名额但不提交样本（请求未真正执行，如被其他限制器拒绝）
+         */
+        void Cancel();
+
+        /**
+         * @brief GetLimit 获取当前并发上限
+         * @return 当前并发上限
+         */
+        int GetLimit() const;
+
+        /**
+         * @brief GetInflight 获取当前在途请求数
+         * @return 当前在途请求数
+         */
+        int GetInflight() const;
+
+    private:
+        /**
+         * @brief 采样窗口结束时根据窗口内的 RTT 更新 limit（调用方需持有锁）
+         */
+        void UpdateLimit();
+
+        Options options_;
+        mutable std::mutex mutex_;
+
+        double limit_;                  // 当前并发上限（浮点便于平滑）
+        int inflight_ = 0;              // 当前在途请求数
+        double rtt_noload_ = 0;         // 无负载 RTT（微秒），0 表示尚未测得
+
+        // 当前采样窗口的统计
+        std::chrono::steady_clock::time_point window_start_;
+        double window_rtt_sum_ = 0;     // 窗口内 RTT 总和（微秒）
+        double window_rtt_min_ = 0;     // 窗口内最小 RTT（微秒）
+        int window_samples_ = 0;        // 窗口内样本数
+        int window_max_inflight_ = 0;   // 窗口内观察到的最大在途请求数
+        int windows_ = 0;               // 已完成的窗口数
+};
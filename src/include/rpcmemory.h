@@ -0,0 +1,106 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <vector>
+
+/**
+ * @brief RpcMemoryBudget 服务端持有的内存的统计与全局预算
+ *        按用途分三类统计（字节数，均为 RpcMetrics 中的计数器）：
+ *        1. Read：已接收但尚未组成完整请求的数据（会话的 pending_ 及正在接收的分块），provider.memory_read_bytes
+ *        2. Call：已解码、尚未执行完成的请求（按请求消息的长度计），provider.memory_call_bytes
+ *        3. Write：已产生、尚未发送完成的响应，provider.memory_write_bytes
+ *        总量为 provider.memory_bytes；每个方法的统计为 provider.method.<包名.服务>.<方法>.memory_bytes；
+ *        每个会话的统计（RpcProvider::Session::MemoryBytes）只在进程内使用，不按会话发布到 RpcMetrics
+ *        （会话数量不受限制），只发布单个会话的历史最大值 provider.memory_session_max_bytes
+ *        总量达到预算（limit，0 表示不限制）时会话暂停读取（不再接收新请求），回落到预算的 7/8 以下时恢复，
+ *        请求不再堆积到耗尽内存，而是留在客户端和内核的套接字缓冲区中
+ *        线程安全：所有方法可在任意线程调用
+ */
+class RpcMemoryBudget {
+    public:
+        /**
+         * @brief 内存的用途
+         */
+        enum class Kind {
+            Read,
+            Call,
+            Write,
+        };
+
+        RpcMemoryBudget();
+
+        /**
+         * @brief 析构函数：丢弃仍在等待的恢复回调（不执行），见 DropWaiters
+         */
+        ~RpcMemoryBudget();
+
+        RpcMemoryBudget(const RpcMemoryBudget&) = delete;
+        RpcMemoryBudget& operator=(const RpcMemoryBudget&) = delete;
+
+        /**
+         * @brief SetLimit 设置预算
+         * @param limit 预算（字节），0 表示不限制
+         */
+        void SetLimit(int64_t limit);
+
+        /**
+         * @brief Add 登记占用或释放的内存
+         * @param kind 用途
+         * @param bytes 字节数，释放时为负数；释放后回落到恢复线以下时执行等待中的恢复回调
+         */
+        void Add(Kind kind, int64_t bytes);
+
+        /**
+         * @brief ObserveSession 记录一个会话当前持有的内存，更新单个会话的历史最大值
+         * @param bytes 会话持有的字节数
+         */
+        void ObserveSession(int64_t bytes);
+
+        /**
+         * @brief Exceeded 总量是否已达到预算
+         * @return 达到预算返回 true，未设置预算时总是返回 false
+         */
+        bool Exceeded() const;
+
+        /**
+         * @brief WaitBelow 登记一个恢复回调，总量回落到恢复线以下时执行一次（登记时已回落则立即执行）
+         *        回调在释放内存的线程中执行，应尽快返回（如把恢复读取投递到会话的 strand）
+         * @param resume 恢复回调
+         */
+        void WaitBelow(std::function<void()> resume);
+
+        /**
+         * @brief DropWaiters 丢弃所有等待中的恢复回调（不执行），回调捕获的对象在调用线程中析构
+         *        回调持有的会话依赖IO上下文，停止服务时应在IO上下文析构之前调用
+         */
+        void DropWaiters();
+
+        /**
+         * @brief Used 获取总量
+         * @return 字节数
+         */
+        int64_t Used() const { return used_.load(std::memory_order_relaxed); }
+
+    private:
+        /**
+         * @brief 总量是否低于恢复线
+         */
+        bool BelowResume() const;
+
+        /**
+         * @brief 取出并执行所有等待中的恢复回调（总量已低于恢复线）
+         */
+        void WakeWaiters();
+
+        std::atomic<int64_t> limit_{0};
+        std::atomic<int64_t>& used_;            // 总量
+        std::atomic<int64_t>* kinds_[3];        // 各用途的字节数
+        std::atomic<int64_t>& sessionMax_;      // 单个会话的历史最大值
+        std::atomic<int64_t>& pauses_;          // 会话因超过预算暂停读取的次数
+        std::mutex mutex_;                      // 保护 waiters_
+        std::vector<std::function<void()>> waiters_;    // 等待恢复的回调
+        std::atomic<size_t> waiting_{0};        // waiters_ 中的回调数，释放内存时据此判断是否需要加锁
+};
@@ -0,0 +1,75 @@
+#pragma once
+
+#include <google/protobuf/message.h>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+/**
+ * @brief RpcMessagePool 一种消息类型的对象池：释放的消息 Clear() 后缓存起来复用，代替每次调用的 New() / delete
+ *        1. 每个线程为每个对象池保留一个空闲链表（thread_local，无锁），最多 max_per_thread 个对象
+ *        2. 请求/响应在IO线程中创建、在工作线程中释放：线程缓存满时把一半移到共享链表，
+ *           线程缓存为空时从共享链表批量取回（加锁，每次搬运一批）；共享链表超过 max_shared 个时直接释放
+ *        3. Clear() 保留字符串和 repeated 字段的容量，序列化长度超过 max_message_bytes 的对象直接释放，
+ *           偶尔出现的大消息不会长期占用内存
+ *        复用的对象与新建的对象没有区别；服务方法不能在执行 done 之后继续使用请求/响应（与不使用对象池时相同）
+ *        线程安全：Acquire / Release 可在任意线程并发调用
+ */
+class RpcMessagePool {
+    public:
+        /**
+         * @brief 对象池参数
+         */
+        struct Options {
+            size_t max_per_thread = 32;         // 每个线程缓存的对象数上限
+            size_t max_shared = 256;            // 共享链表的对象数上限
+            size_t max_message_bytes = 64 * 1024;   // 序列化长度超过该值的对象不缓存
+        };
+
+        /**
+         * @brief 构造函数
+         * @param prototype 消息类型的原型（由 protobuf 生成代码持有，生命周期长于对象池）
+         * @param options 对象池参数
+         */
+        RpcMessagePool(const google::protobuf::Message* prototype, const Options& options);
+
+        /**
+         * @brief 析构函数：释放共享链表中的对象并归还编号
+         *        各线程缓存中的对象随之失效，在该线程下次使用同一编号（被新的对象池复用）时或线程退出时释放
+         */
+        ~RpcMessagePool();
+
+        RpcMessagePool(const RpcMessagePool&) = delete;
+        RpcMessagePool& operator=(const RpcMessagePool&) = delete;
+
+        /**
+         * @brief Acquire 取出一个空的消息对象，没有缓存的对象时新建
+         * @return 消息对象，通过 Release 归还
+         */
+        google::protobuf::Message* Acquire();
+
+        /**
+         * @brief Release 归还消息对象
+         * @param message 由 Acquire 取出的消息对象
+         * @param bytes 消息的序列化长度（用于判断是否缓存，未知时为 0）
+         */
+        void Release(google::protobuf::Message* message, size_t bytes);
+
+    private:
+        /**
+         * @brief 当前线程中该对象池的空闲链表
+         */
+        std::vector<google::protobuf::Message*>& LocalCache();
+
+        const google::protobuf::Message* prototype_;
+        Options options_;
+        size_t id_;                                     // 对象池编号，即线程缓存中的下标（对象池析构后复用）
+        uint64_t generation_;                           // 全局唯一的代数，线程缓存据此识别已析构对象池留下的对象
+        std::mutex mutex_;                              // 保护 shared_
+        std::vector<google::protobuf::Message*> shared_;    // 线程之间转移对象的共享链表
+        std::atomic<int64_t>& hits_;                    // 复用缓存对象的次数（省下的 New）
+        std::atomic<int64_t>& misses_;                  // 没有缓存对象而新建的次数
+        std::atomic<int64_t>& drops_;                   // 超过上限或消息过大而释放的次数
+};
@@ -0,0 +1,51 @@
+#pragma once
+
+#include <atomic>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+
+/**
+ * @brief RpcMetrics rpc框架的运行指标（计数器）
+ *        计数器按名字注册，返回的引用在程序运行期间一直有效，热点路径上应缓存引用，例如:
+ *        static std::atomic<int64_t>& calls = RpcMetrics::GetInstance().Counter("provider.write_calls");
+ *        calls.fetch_add(1, std::memory_order_relaxed);
+ */
+class RpcMetrics {
+    public:
+        /**
+         * @brief GetInstance 获取单例对象
+         * @return RpcMetrics& 单例对象引用
+         */
+        static RpcMetrics& GetInstance();
+
+        /**
+         * @brief Counter 获取（不存在时创建）指定名字的计数器
+         * @param name 计数器名字，如 "provider.write_calls"
+         * @return 计数器引用
+         */
+        std::atomic<int64_t>& Counter(const std::string& name);
+
+        /**
+         * @brief Snapshot 获取所有计数器当前值的快照
+         * @return 计数器名字到当前值的映射（按名字排序）
+         */
+        std::map<std::string, int64_t> Snapshot() const;
+
+        /**
+         * @brief Dump 以 "name value" 每行一个的格式输出所有计数器
+         * @param os 输出流
+         */
+        void Dump(std::ostream& os) const;
+
+    private:
+        RpcMetrics() = default;
+
+        RpcMetrics(const RpcMetrics&) = delete;
+        RpcMetrics& operator=(const RpcMetrics&) = delete;
+
+        mutable std::mutex mutex_;
+        std::map<std::string, std::unique_ptr<std::atomic<int64_t>>> counters_;
+};
@@ -2,7 +2,28 @@
 
 #include "google/protobuf/service.h"
 #include <unordered_map>
+#include <memory>
+#include <deque>
+#include <vector>
+#include <atomic>
+#include <chrono>
+#include <mutex>
 #include <boost/asio.hpp>
+#include "rpclimiter.h"
+#include "rpcexecutor.h"
+#include "rpcbatchservice.h"
+#include "rpccontroller.h"
+#include "rpcstream.h"
+#include "rpcchunk.h"
+#include "rpchandshake.h"
+#include "rpcmessagepool.h"
+#include "rpcallocator.h"
+#include "rpcbufferpool.h"
+#include "rpcmemory.h"
+
+namespace rpcheader {
+class RpcHeader;
+}
 
 /**
  * @brief RpcProvider 用于发布rpc服务的网络对象类
@@ -22,32 +43,140 @@ class RpcProvider {
          */
         void Run();
 
+        /**
+         * @brief Stop 停止rpc服务节点，Run 在所有IO线程退出后返回（可在任意线程调用）
+         */
+        void Stop();
+
     private:
+        class Session;
+
+        // IO线程数
+        static constexpr int kIoThreads = 6;
+
+        /**
+         * @brief SessionShard 一部分会话按最近活动时间排列的侵入式双向链表（LRU），表头为最久未活动的会话
+         *        会话按 id 分到 kIoThreads 个分片，IO线程之间很少争用同一把锁；
+         *        活动时间按粗粒度时钟（coarseNow_，秒）记录，同一秒内的多次活动只移动一次
+         */
+        struct SessionShard {
+            std::mutex mutex_;              // 保护链表及会话的 lruPrev_ / lruNext_ / lruLinked_
+            Session* head_ = nullptr;       // 最久未活动
+            Session* tail_ = nullptr;       // 最近活动
+        };
+
+        // 内存统计与全局预算；先于 io_context_ 构造、后于其析构（io_context_ 析构时释放的会话仍会归还内存）；
+        // 恢复回调持有的会话在 Run 返回前通过 DropWaiters 释放
+        RpcMemoryBudget memory_;
+        // 会话的 LRU 链表，同样需要后于 io_context_ 析构（会话析构时从链表中移除）
+        SessionShard sessionShards_[kIoThreads];
         boost::asio::io_context io_context_;    // Boost.Asio IO上下文对象
 
+        struct CallContext;
+        struct MethodBatcher;
+
+        /**
+         * @brief MethodInfo 保存服务方法描述符及其运行时状态的结构体
+         */
+        struct MethodInfo {
+            const google::protobuf::MethodDescriptor* method_;  // 服务方法描述符
+            std::unique_ptr<ConcurrencyLimiter> limiter_;       // 方法级并发限制器（未开启限流时为空）
+            RpcExecutor::Priority priority_;                    // 方法的调度优先级
+            std::unique_ptr<MethodBatcher> batcher_;            // 批处理方法的攒批器（非批处理方法为空）
+            bool streaming_ = false;                            // 是否为流式方法
+            bool clientStreaming_ = false;                      // 客户端是否发送消息流（客户端流、双向流）
+            bool serverStreaming_ = false;                      // 服务端是否发送消息流（服务端流、双向流）
+            std::unique_ptr<RpcMessagePool> requestPool_;       // 请求消息对象池（未开启对象池时为空）
+            std::unique_ptr<RpcMessagePool> responsePool_;      // 响应消息对象池（未开启对象池时为空）
+            std::atomic<int64_t>* memoryBytes_ = nullptr;       // 该方法执行中的请求持有的内存（RpcMetrics 计数器）
+        };
+
         /**
          * @brief ServiceInfo 保存服务对象和服务方法的结构体
          */
         struct ServiceInfo {
             google::protobuf::Service* service_;   // 保存服务对象
-            std::unordered_map<std::string, const google::protobuf::MethodDescriptor*> methodMap_; // 保存服务方法
+            std::unordered_map<std::string, MethodInfo> methodMap_; // 保存服务方法
         };
         // 保存注册的服务对象和其服务方法的映射表
         std::unordered_map<std::string, ServiceInfo> serviceMap_;
 
+        /**
+         * @brief MethodRoute 方法id对应的服务和方法（指向 serviceMap_ 中的元素，哈希冲突的方法id两者都为空）
+         */
+        struct MethodRoute {
+            ServiceInfo* service_;
+            MethodInfo* method_;
+        };
+        // 方法id（见 rpcframe.h）到服务方法的映射表，定长数据头的请求据此分发
+        std::unordered_map<uint32_t, MethodRoute> methodIds_;
+        // 哈希冲突的方法id（升序），在握手回复中告知客户端
+        std::vector<uint32_t> ambiguousMethodIds_;
+
+        // 服务级并发限制器（未开启限流时为空）
+        std::unique_ptr<ConcurrencyLimiter> serverLimiter_;
+
+        // 执行rpc方法的工作线程池，IO线程只负责读写和解码
+        std::unique_ptr<RpcExecutor> executor_;
+
+        // 执行流式方法的工作线程池（stream.threads 个线程）：流式方法阻塞在 Read / Write 上时只占用这里的线程，
+        // 慢速或空闲的流式客户端不会耗尽执行一元调用的 executor_
+        std::unique_ptr<RpcExecutor> streamExecutor_;
+
+        // 进行中的流式调用，停止时全部中断，阻塞在 Read / Write 上的流式方法返回后 streamExecutor_ 才能停止
+        std::mutex liveStreamsMutex_;
+        std::vector<std::weak_ptr<RpcStream>> liveStreams_;
+        size_t liveStreamsPrune_ = 64;      // liveStreams_ 达到该长度时清理已结束的流
+
+        // 是否合并发送：一次写操作发送所有已就绪的响应
+        bool writeCoalescing_ = true;
+
+        // 流式调用的接收窗口（消息数）
+        uint32_t streamWindow_ = 16;
+
+        // 大响应的分块大小（0 表示不分块）
+        size_t chunkSize_ = 64 * 1024;
+
+        // 单个请求/响应消息的最大长度
+        size_t maxMessageSize_ = 64 * 1024 * 1024;
+
+        // 客户端在握手中声明支持时，发送的帧是否带 CRC32C 校验和（接收时按帧中的标志校验，与该配置无关）
+        bool checksum_ = false;
+
+        // 会话未发送的响应达到高水位时暂停读取该会话的请求，回落到低水位以下时恢复（高水位为 0 表示不限制）
+        size_t writeHighWater_ = 4 * 1024 * 1024;
+        size_t writeLowWater_ = 1024 * 1024;
+
+        // 空闲连接回收及连接数上限（见 SessionShard）
+        bool trackSessions_ = false;            // 是否维护会话的 LRU 链表（开启任一功能时）
+        uint32_t idleTimeout_ = 0;              // 连接空闲超过该秒数时关闭，0 表示不回收
+        size_t maxConnections_ = 0;             // 连接数上限，达到时关闭最久未活动的空闲连接，0 表示不限制
+        std::atomic<uint32_t> coarseNow_{1};    // 粗粒度时钟（秒），由 sweepTimer_ 每秒更新
+        std::unique_ptr<boost::asio::steady_timer> sweepTimer_;    // 每秒推进时钟并回收空闲连接
+
         /**
          * @brief ASIO会话类
+         *        一个会话对应一条客户端连接，连接上可以连续（流水线）发送多个请求，
+         *        响应通过 request_id 与请求对应，不保证按请求顺序返回
          */
         class Session : public std::enable_shared_from_this<Session> {
             public:
                 /**
                  * @brief 构造函数
-                 * @param socket TCP套接字
+                 * @param socket TCP套接字（其执行器为该连接独占的 strand，保证回调串行执行）
                  * @param provider RpcProvider对象引用
+                 * @param id 会话id
                  */
-                Session(boost::asio::ip::tcp::socket socket, RpcProvider& provider)
+                Session(boost::asio::ip::tcp::socket socket, RpcProvider& provider, uint64_t id)
                     : socket_(std::move(socket)),
-                      provider_(provider) {}
+                      provider_(provider),
+                      id_(id),
+                      chunks_(provider.maxMessageSize_) {}
+
+                /**
+                 * @brief 析构函数：归还会话仍持有的内存统计（未发送的响应、未接收完整的请求）
+                 */
+                ~Session();
 
                 /**
                  * @brief 启动会话
@@ -55,33 +184,431 @@ class RpcProvider {
                 void Start();
 
                 /**
-                 * @brief 写入数据
+                 * @brief 关闭连接（空闲回收或为新连接让出名额），可在任意线程调用
+                 */
+                void Close();
+
+                /**
+                 * @brief 记录连接上的活动，粗粒度时钟变化后才移动到 LRU 链表的表尾（在 strand 中调用）
+                 */
+                void Touch() {
+                    if (provider_.trackSessions_ &&
+                        lastActive_.load(std::memory_order_relaxed) != provider_.coarseNow_.load(std::memory_order_relaxed)) {
+                        provider_.TouchSession(this);
+                    }
+                }
+
+                /**
+                 * @brief 执行中的请求数增减（执行中的会话不算空闲），可在任意线程调用
+                 * @param delta 增量
+                 */
+                void AddCalls(int delta) { calls_.fetch_add(delta, std::memory_order_relaxed); }
+
+                /**
+                 * @brief 写入数据，可在任意线程调用，数据进入发送队列后按顺序发送
                  * @param response 响应数据
                  */
-                void DoWrite(const std::string& response);
+                void DoWrite(std::string response);
+
+                /**
+                 * @brief 分块写入一个大响应，可在任意线程调用；每次写操作最多发送它的一个分块，
+                 *        多个大响应轮流发送，其他响应可以插在分块之间发送
+                 * @param frame 待分块发送的响应
+                 */
+                void DoWriteChunked(std::unique_ptr<ChunkedFrame> frame);
+
+                /**
+                 * @brief 获取连接上正在接收的分块请求（只在 strand 中访问）
+                 * @return 分块组装器
+                 */
+                ChunkAssembler& Chunks() { return chunks_; }
+
+                /**
+                 * @brief 记录客户端在握手中声明的能力（只在 strand 中调用）
+                 * @param peer 客户端的能力
+                 */
+                void SetPeer(const RpcHandshake::Capabilities& peer);
+
+                /**
+                 * @brief 获取客户端能够解压的算法集合，可在任意线程调用
+                 * @return 算法集合，客户端没有握手时为 0（不压缩）
+                 */
+                uint32_t PeerCompression() const { return peerCompression_.load(std::memory_order_relaxed); }
+
+                /**
+                 * @brief 获取客户端能够接收的单个消息的最大长度，可在任意线程调用
+                 * @return 最大长度，客户端没有握手或未声明时为 0
+                 */
+                uint64_t PeerMaxMessageSize() const { return peerMaxMessageSize_.load(std::memory_order_relaxed); }
+
+                /**
+                 * @brief 登记客户端为方法分配的连接内序号（只在 strand 中访问）
+                 * @param index 序号，超过 RpcFrame::kMaxMethodIndex 时忽略
+                 * @param route 序号对应的服务和方法
+                 */
+                void InternMethod(uint32_t index, const MethodRoute& route);
+
+                /**
+                 * @brief 查找连接内序号对应的方法（只在 strand 中访问）
+                 * @param index 序号
+                 * @return 服务和方法，序号未登记时返回空
+                 */
+                const MethodRoute* FindMethod(uint32_t index) const;
+
+                /**
+                 * @brief 获取会话id
+                 * @return 会话id
+                 */
+                uint64_t GetId() const { return id_; }
+
+                /**
+                 * @brief 登记会话占用或释放的内存，同时计入服务端的总量，可在任意线程调用
+                 * @param kind 用途
+                 * @param bytes 字节数，释放时为负数
+                 */
+                void Charge(RpcMemoryBudget::Kind kind, int64_t bytes);
+
+                /**
+                 * @brief 获取会话持有的内存，可在任意线程调用
+                 * @return 未接收完整的请求、执行中的请求及未发送的响应的总字节数
+                 */
+                int64_t MemoryBytes() const;
+
+                /**
+                 * @brief 登记连接上的一个流式调用，用于接收客户端发来的授信
+                 * @param request_id 请求id
+                 * @param stream 消息流
+                 */
+                void AddStream(uint64_t request_id, std::shared_ptr<RpcStream> stream);
+
+                /**
+                 * @brief 流式调用结束，取消登记
+                 * @param request_id 请求id
+                 */
+                void RemoveStream(uint64_t request_id);
+
+                /**
+                 * @brief 查找连接上的流式调用
+                 * @param request_id 请求id
+                 * @return 消息流，不存在时返回空
+                 */
+                std::shared_ptr<RpcStream> FindStream(uint64_t request_id);
 
             private:
+                friend class RpcProvider;   // 维护 LRU 链表的成员
+
                 /**
-                 * @brief 读取数据
+                 * @brief 连接断开，中断所有流式调用（唤醒阻塞在 Write 上的服务方法）
+                 */
+                void CloseStreams();
+
+                /**
+                 * @brief 等待套接字可读，可读后再从缓冲区池取出缓冲区读取数据（空闲连接不占用读缓冲区）
                  */
                 void DoRead();
 
+                /**
+                 * @brief 套接字可读：非阻塞读取一次并处理其中的完整请求（在 strand 中调用）
+                 * @return 连接已关闭返回 false
+                 */
+                bool ReadAvailable();
+
+                /**
+                 * @brief 处理一段数据中的完整请求
+                 * @param data 数据
+                 * @param size 数据长度
+                 * @param consumed 输出参数，已处理的长度
+                 * @return 请求格式错误返回 false
+                 */
+                bool HandleData(const char* data, size_t size, size_t* consumed);
+
+                /**
+                 * @brief 按 pending_ 和 chunks_ 的当前长度更新未接收完整的请求占用的内存统计（在 strand 中调用）
+                 */
+                void UpdateReadBytes();
+
+                /**
+                 * @brief 发送队列中已就绪的数据（需在 strand 中调用）
+                 *        开启合并发送时，所有已就绪的响应通过一次 scatter/gather 写（writev）发送，
+                 *        同时附带队首大响应的一个分块
+                 */
+                void StartWrite();
+
                 boost::asio::ip::tcp::socket socket_;  // TCP套接字
                 RpcProvider& provider_;                 // 引用RpcProvider对象
-                std::vector<char> buffer_;               // 读取数据缓冲区
+                uint64_t id_;                           // 会话id
+                int readClass_ = 0;                     // 下一次读取使用的缓冲区级别（见 RpcBufferPool，按上次读取的长度调整）
+                std::string pending_;                   // 已接收但尚未组成完整请求的数据（处理完后释放内存）
+                std::deque<std::string> writeQueue_;    // 待发送的响应数据（只在 strand 中访问）
+                std::vector<std::string> writing_;      // 正在发送的响应数据（只在 strand 中访问）
+                std::vector<boost::asio::const_buffer> writeBuffers_;  // 正在发送的缓冲区（复用容量，只在 strand 中访问）
+                int64_t writingBytes_ = 0;              // 本次写操作完成后释放的响应字节数（只在 strand 中访问）
+                bool readPaused_ = false;               // 未发送的响应超过高水位，已暂停读取（只在 strand 中访问）
+                std::deque<std::unique_ptr<ChunkedFrame>> chunkedQueue_;   // 待分块发送的大响应（只在 strand 中访问）
+                std::unique_ptr<ChunkedFrame> chunkedWriting_;             // 正在发送其中一个分块的大响应
+                bool writeActive_ = false;              // 是否有写操作正在进行
+                ChunkAssembler chunks_;                 // 正在接收的分块请求（只在 strand 中访问）
+                RpcHandlerMemory readMemory_;           // 读操作链的回调内存
+                RpcHandlerMemory writeMemory_;          // 写操作链的回调内存
+                // 客户端在握手中声明的能力
+                std::atomic<uint32_t> peerCompression_{0};  // 能够解压的算法集合
+                std::atomic<uint64_t> peerMaxMessageSize_{0};   // 能够接收的单个消息的最大长度
+                std::atomic<bool> peerChecksum_{false};     // 能够校验帧的校验和（否则不发送校验和）
+                // 会话持有的内存（见 RpcMemoryBudget::Kind）
+                std::atomic<int64_t> readBytes_{0};     // 未接收完整的请求（pending_ 及 chunks_，只在 strand 中修改）
+                std::atomic<int64_t> callBytes_{0};     // 执行中的请求
+                std::atomic<int64_t> writeBytes_{0};    // 未发送完成的响应
+                // LRU 链表（由所在分片的 mutex_ 保护）
+                Session* lruPrev_ = nullptr;
+                Session* lruNext_ = nullptr;
+                bool lruLinked_ = false;
+                std::atomic<uint32_t> lastActive_{0};   // 最近活动的粗粒度时间
+                std::atomic<int32_t> calls_{0};         // 执行中的请求数
+                std::vector<MethodRoute> methods_;      // 连接内序号登记的方法，下标为序号 - 1（只在 strand 中访问）
+                std::mutex streamsMutex_;               // 保护 streams_（流式调用在工作线程中结束）
+                std::unordered_map<uint64_t, std::shared_ptr<RpcStream>> streams_;  // 进行中的流式调用
+        };
+        // 下一个会话id
+        std::atomic<uint64_t> nextSessionId_{1};
+
+        /**
+         * @brief BatchContext 一个批量请求在执行期间需要保存的上下文
+         *        子请求各自调度执行，子响应全部就绪后组装成一个批量响应发送
+         */
+        struct BatchContext {
+            std::shared_ptr<Session> session_;          // 会话对象
+            uint64_t request_id_;                       // 批量请求的请求id
+            std::vector<std::string> responses_;        // 子响应字符流，按子请求顺序存放
+            std::atomic<size_t> remaining_;             // 尚未就绪的子响应数
+        };
+
+        /**
+         * @brief ReplyTarget 响应的去向：直接发送给会话，或者填入批量响应的一个位置（单向请求没有去向）
+         */
+        struct ReplyTarget {
+            std::shared_ptr<Session> session_;          // 会话对象
+            std::shared_ptr<BatchContext> batch_;       // 所属的批量请求（普通请求为空）
+            size_t index_;                              // 在批量请求中的位置
+            bool oneWay_ = false;                       // 单向请求：不发送任何响应
+            bool fixed_ = false;                        // 请求使用定长数据头，响应同样使用定长数据头（批量请求的子响应除外）
+        };
+
+        /**
+         * @brief CallContext 一次rpc调用在执行期间需要保存的上下文
+         */
+        struct CallContext {
+            ReplyTarget reply_;                         // 响应的去向
+            uint64_t request_id_;                       // 请求id
+            google::protobuf::Service* service_;        // 服务对象
+            google::protobuf::Message* request_;        // 请求消息对象
+            google::protobuf::Message* response_;       // 响应消息对象
+            MethodInfo* methodInfo_;                    // 被调用的方法
+            std::chrono::steady_clock::time_point start_;   // 获得并发名额的时间，用于计算 RTT
+            RpcController controller_;                  // 调用的控制器：请求元数据、响应元数据及失败状态，流式调用时持有消息流
+            std::chrono::steady_clock::time_point deadline_ = std::chrono::steady_clock::time_point::max();   // 客户端设置的截止时间
+            size_t requestBytes_ = 0;                   // 请求消息的长度（归还对象池时据此判断是否缓存）
+        };
+
+        /**
+         * @brief MethodBatcher 批处理方法的攒批器
+         *        同一方法并发到达的请求先在这里攒成一批，达到 maxItems_ 个或第一个请求等待 maxDelay_ 后整批投递执行
+         */
+        struct MethodBatcher {
+            MethodBatcher(boost::asio::io_context& io_context, RpcBatchService* service,
+                          size_t max_items, std::chrono::microseconds max_delay)
+                : service_(service),
+                  maxItems_(max_items),
+                  maxDelay_(max_delay),
+                  timer_(io_context) {}
+
+            RpcBatchService* service_;                  // 批处理服务对象
+            size_t maxItems_;                           // 一批的最大请求数
+            std::chrono::microseconds maxDelay_;        // 一批中第一个请求的最长等待时间
+            std::mutex mutex_;                          // 保护以下成员（请求可能来自多个IO线程）
+            std::vector<CallContext*> calls_;           // 正在攒的一批请求
+            boost::asio::steady_timer timer_;           // 最长等待时间定时器
+            uint64_t generation_ = 0;                   // 每取出一批加一，过期的定时器据此忽略
         };
-        
+
+        /**
+         * @brief LoadLimiterOptions 从配置文件读取限制器参数
+         * @param prefix 配置项前缀，如 "limiter.server"
+         * @return 限制器参数
+         */
+        static ConcurrencyLimiter::Options LoadLimiterOptions(const std::string& prefix);
+
         /**
-         * @brief 处理请求
+         * @brief LoadExecutorOptions 从配置文件读取执行器参数
+         * @return 执行器参数
+         */
+        static RpcExecutor::Options LoadExecutorOptions();
+
+        /**
+         * @brief LoadMethodPriority 获取方法的调度优先级
+         *        优先使用配置文件 executor.priority.methods 中 "服务名.方法名" 的配置，
+         *        否则使用 .proto 中 (rpcoptions.priority) 选项声明的优先级
+         * @param method 方法描述符
+         * @return 调度优先级
+         */
+        static RpcExecutor::Priority LoadMethodPriority(const google::protobuf::MethodDescriptor* method);
+
+        /**
+         * @brief 处理请求：从接收到的字符流中解析出一个完整的请求并投递执行
          * @param session 会话对象
-         * @param request_data 请求数据
+         * @param data 已接收的数据
+         * @param size 已接收数据的长度
+         * @param consumed 输出参数，本次解析消耗的字节数，数据不足一个完整请求时为 0
+         * @return 请求格式错误（连接应被关闭）时返回 false
          */
-        void HandleRequest(std::shared_ptr<Session> session, const std::string& request_data);
+        bool HandleRequest(std::shared_ptr<Session> session, const char* data, size_t size, size_t* consumed);
 
         /**
-         * @brief 发送RPC响应（用于Closure回调）
+         * @brief 处理批量请求：拆分出所有子请求，分别投递执行
          * @param session 会话对象
-         * @param response 响应消息对象
+         * @param header 批量请求的数据头
+         * @param args 批量请求的参数（依次拼接的子请求字符流）
+         * @param args_size 参数长度
+         * @return 子请求格式错误（连接应被关闭）时返回 false
+         */
+        bool HandleBatchRequest(std::shared_ptr<Session> session, const rpcheader::RpcHeader& header,
+                                const char* args, size_t args_size);
+
+        /**
+         * @brief 查找请求的服务方法，反序列化参数后投递到工作线程池执行
+         * @param reply 响应的去向
+         * @param header 请求的数据头（其中的元数据被移入调用的控制器）
+         * @param args 请求参数
+         * @param args_size 请求参数长度
+         * @param chain 分块接收的请求参数，不为空时忽略 args
+         */
+        void DispatchRequest(const ReplyTarget& reply, rpcheader::RpcHeader& header,
+                             const char* args, size_t args_size, const BufferChain* chain = nullptr);
+
+        /**
+         * @brief 在工作线程中执行rpc方法
+         * @param call 调用上下文
+         */
+        void CallServiceMethod(CallContext* call);
+
+        /**
+         * @brief 批处理方法的请求进入攒批器，攒满一批时投递执行
+         * @param call 调用上下文
+         */
+        void EnqueueBatchCall(CallContext* call);
+
+        /**
+         * @brief 把攒好的一批请求作为一个任务投递到工作线程池
+         * @param calls 一批调用（同一方法），执行或丢弃后释放
+         */
+        void SubmitBatch(std::vector<CallContext*>* calls);
+
+        /**
+         * @brief 在工作线程中批量执行rpc方法
+         * @param calls 一批调用（同一方法）
+         */
+        void CallServiceMethodBatch(std::vector<CallContext*>* calls);
+
+        /**
+         * @brief 批量执行完成后的回调：把各个响应分别发回各自的连接
+         * @param calls 一批调用
+         */
+        void SendRpcResponseBatch(std::vector<CallContext*>* calls);
+
+        /**
+         * @brief 请求没有执行就被丢弃（排队过久或已超过截止时间）：归还并发名额并返回错误
+         * @param call 调用上下文
+         * @param status 状态码（rpcheader::RpcStatus）
+         * @param error_text 错误信息
+         */
+        void ShedRpcCall(CallContext* call, int status, const std::string& error_text);
+
+        /**
+         * @brief 会话加入所在分片 LRU 链表的表尾
+         * @param session 会话
+         */
+        void LinkSession(Session* session);
+
+        /**
+         * @brief 会话加入分片链表的表尾（需持有分片的 mutex_）
+         * @param shard 分片
+         * @param session 会话
+         */
+        void PushSession(SessionShard& shard, Session* session);
+
+        /**
+         * @brief 会话从分片链表中移除（需持有分片的 mutex_，会话在链表中）
+         * @param shard 分片
+         * @param session 会话
+         */
+        void RemoveSession(SessionShard& shard, Session* session);
+
+        /**
+         * @brief 会话从 LRU 链表中移除（不在链表中时忽略）
+         * @param session 会话
+         */
+        void UnlinkSession(Session* session);
+
+        /**
+         * @brief 会话有活动：移动到所在分片 LRU 链表的表尾
+         * @param session 会话
+         */
+        void TouchSession(Session* session);
+
+        /**
+         * @brief 每秒推进粗粒度时钟，并从各分片的表头开始关闭空闲超时的连接
+         *        只检查已超时的会话及每个分片的一个未超时会话，开销与连接总数无关
+         */
+        void SweepSessions();
+
+        /**
+         * @brief 连接数达到上限：关闭各分片表头中最久未活动的空闲连接
+         * @return 没有可关闭的空闲连接时返回 false
+         */
+        bool EvictIdleSession();
+
+        /**
+         * @brief 登记进行中的流式调用（停止时由 CloseLiveStreams 中断）
+         * @param stream 消息流
+         */
+        void TrackStream(const std::shared_ptr<RpcStream>& stream);
+
+        /**
+         * @brief 中断所有进行中的流式调用，唤醒阻塞在 Read / Write 上的流式方法
+         */
+        void CloseLiveStreams();
+
+        /**
+         * @brief 调用结束：归还请求占用的内存统计并释放调用上下文
+         * @param call 调用上下文
+         */
+        void ReleaseCall(CallContext* call);
+
+        /**
+         * @brief 发送RPC响应（用于Closure回调），并归还并发名额
+         * @param call 调用上下文
+         */
+        void SendRpcResponse(CallContext* call);
+
+        /**
+         * @brief 流式调用结束：取消登记并中断消息流，释放控制器持有的消息流（最终响应帧由调用方发送）
+         * @param call 调用上下文
+         */
+        void FinishStream(CallContext* call);
+
+        /**
+         * @brief 发送不带响应消息体的响应（错误响应，或流式调用的最终响应）
+         * @param reply 响应的去向
+         * @param request_id 请求id
+         * @param status 状态码（rpcheader::RpcStatus）
+         * @param error_text 错误信息
+         */
+        void SendRpcError(const ReplyTarget& reply, uint64_t request_id, int status, const std::string& error_text);
+
+        /**
+         * @brief 发送一个响应字符流：普通请求直接写入会话；
+         *        批量请求的子响应填入对应位置，最后一个子响应就绪时发送整个批量响应
+         * @param reply 响应的去向
+         * @param frame 响应字符流
          */
-        void SendRpcResponse(std::shared_ptr<Session> session, google::protobuf::Message* response);
+        void Reply(const ReplyTarget& reply, std::string frame);
 };
\ No newline at end of file
@@ -0,0 +1,132 @@
+#pragma once
+
+#include <google/protobuf/message.h>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <string>
+
+/**
+ * @brief RpcStream 流式调用的消息流，客户端和服务端通过 RpcController::GetStream 获取
+ *        1. 服务端流：服务端方法通过 Write 逐条发送响应消息，执行 done 结束流；
+ *           客户端通过 Read 逐条读取，Read 返回 false 后通过 controller->Failed() 判断流是否正常结束
+ *        2. 客户端流：客户端通过 Write 逐条发送请求消息，WritesDone 结束发送，Wait 等待最终的响应消息；
+ *           服务端方法通过 Read 逐条读取，Read 返回 false 后填充响应并执行 done
+ *        3. 双向流：两个方向各自独立地读写，服务端执行 done 结束整个调用
+ *        4. 基于授信的流量控制：接收方最多缓存 window 条消息，每消费一半窗口向发送方追加授信；
+ *           发送方没有授信时 Write 阻塞，慢速的接收方不会让发送方无限制地缓存；
+ *           接收方按已授出的额度计数，对端超出额度发送时中止该流（流量控制错误），不再缓存其消息
+ *        流的帧与同一连接上的其他调用交错发送，按 request_id 区分
+ */
+class RpcStream {
+    public:
+        /**
+         * @brief 发送一条消息（已序列化）的函数
+         */
+        using MessageSender = std::function<void(std::string message)>;
+
+        /**
+         * @brief 向对端追加授信的函数
+         */
+        using CreditSender = std::function<void(uint32_t credit)>;
+
+        /**
+         * @brief 通知对端本端不再发送消息的函数
+         */
+        using EndSender = std::function<void()>;
+
+        /**
+         * @brief 通知对端中止流的函数
+         */
+        using ResetSender = std::function<void()>;
+
+        /**
+         * @brief 构造函数
+         * @param window 本端的接收窗口（最多缓存的未读消息数）
+         * @param send_message 发送消息的函数（本端不发送消息时为空，此时 Write 返回 false）
+         * @param send_credit 追加授信的函数（本端不接收消息时可以为空）
+         * @param send_end 结束发送的函数（只有客户端需要）
+         * @param send_reset 中止流的函数（只有客户端需要，服务端通过最终响应的状态报告）
+         */
+        RpcStream(uint32_t window, MessageSender send_message, CreditSender send_credit, EndSender send_end = nullptr,
+                  ResetSender send_reset = nullptr);
+
+        RpcStream(const RpcStream&) = delete;
+        RpcStream& operator=(const RpcStream&) = delete;
+
+        /**
+         * @brief Read 读取一条消息，没有消息时阻塞
+         * @param message 用于存储消息
+         * @return 流已结束（或中断）且没有未读消息时返回 false
+         */
+        bool Read(google::protobuf::Message* message);
+
+        /**
+         * @brief Write 发送一条消息，没有对端授信时阻塞（会占用调用线程；服务端的流式方法在独立的线程池中执行，见 stream.threads）
+         * @param message 要发送的消息
+         * @return 流已中断（如连接断开）、已调用 WritesDone 或本端不发送消息时返回 false
+         */
+        bool Write(const google::protobuf::Message& message);
+
+        /**
+         * @brief WritesDone 客户端不再发送消息，服务端的 Read 读完已发送的消息后返回 false
+         */
+        void WritesDone();
+
+        /**
+         * @brief Wait 客户端等待调用结束（收到服务端的最终响应或连接断开），
+         *        返回后通过 controller 判断结果，客户端流的响应消息已填充到 response
+         */
+        void Wait();
+
+        // ==================== 以下由框架调用 ====================
+
+        /**
+         * @brief 收到对端的一条消息（消耗一个已授出的额度）
+         * @param message 已序列化的消息
+         * @return 对端超出授信窗口时返回 false：丢弃未读的消息、不再接收，并通知对端中止流；
+         *         调用方随后报告错误并调用 Close
+         */
+        bool OnMessage(std::string message);
+
+        /**
+         * @brief 收到对端的授信
+         * @param credit 追加的额度
+         */
+        void OnCredit(uint32_t credit);
+
+        /**
+         * @brief 对端不再发送消息，未读的消息仍可读取
+         */
+        void OnEnd();
+
+        /**
+         * @brief 流中断（连接断开或调用结束），唤醒所有阻塞的 Read / Write
+         */
+        void Close();
+
+        /**
+         * @brief FlowControlError 对端是否超出过授信窗口
+         * @return 超出过返回 true
+         */
+        bool FlowControlError();
+
+    private:
+        uint32_t window_;                   // 本端的接收窗口
+        MessageSender sendMessage_;
+        CreditSender sendCredit_;
+        EndSender sendEnd_;
+        ResetSender sendReset_;
+
+        std::mutex mutex_;
+        std::condition_variable cond_;
+        std::deque<std::string> messages_;  // 已收到尚未读取的消息
+        uint32_t consumed_ = 0;             // 已读取尚未授信的消息数
+        int64_t credits_ = 0;               // 对端允许本端再发送的消息数
+        int64_t granted_ = 0;               // 本端允许对端再发送的消息数（初始窗口由调用方授出）
+        bool flowControlError_ = false;     // 对端超出过授信窗口
+        bool ended_ = false;                // 对端不再发送消息
+        bool closed_ = false;               // 流已中断
+        bool writesDone_ = false;           // 本端不再发送消息
+};
@@ -0,0 +1,173 @@
+#include "rpcallocator.h"
+#include <sys/mman.h>
+#include <atomic>
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include "rpcmetrics.h"
+
+void* RpcHandlerMemory::Allocate(size_t size) {
+    static std::atomic<int64_t>& fallbacks = RpcMetrics::GetInstance().Counter("provider.handler_alloc_fallbacks");
+
+    if (!inUse_ && size <= kSize) {
+        inUse_ = true;
+        return storage_;
+    }
+    fallbacks.fetch_add(1, std::memory_order_relaxed);
+    return ::operator new(size);
+}
+
+void RpcHandlerMemory::Deallocate(void* pointer) {
+    if (pointer == storage_) {
+        inUse_ = false;
+        return;
+    }
+    ::operator delete(pointer);
+}
+
+static std::atomic<int> pageArenaMode{static_cast<int>(RpcPageArena::Mode::Off)};
+
+/**
+ * @brief 大页区域的分配状态：slab 依次排布在当前区域中，放不下时映射新的区域（剩余部分不再使用）
+ */
+struct PageArenaState {
+    std::mutex mutex_;
+    char* region_ = nullptr;    // 当前区域
+    size_t used_ = 0;           // 当前区域已分配的长度
+};
+
+/**
+ * @brief 映射一个按 kRegionSize 对齐的透明大页区域
+ * @return 区域地址，失败时返回 nullptr
+ */
+static char* MapTransparentRegion() {
+    const size_t region_size = RpcPageArena::kRegionSize;
+    // 多映射一个区域的长度，截掉首尾不对齐的部分
+    void* mapped = mmap(nullptr, region_size * 2, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (mapped == MAP_FAILED) {
+        return nullptr;
+    }
+    uintptr_t begin = reinterpret_cast<uintptr_t>(mapped);
+    uintptr_t aligned = (begin + region_size - 1) / region_size * region_size;
+    if (aligned > begin) {
+        munmap(mapped, aligned - begin);
+    }
+    if (begin + region_size * 2 > aligned + region_size) {
+        munmap(reinterpret_cast<void*>(aligned + region_size), begin + region_size * 2 - aligned - region_size);
+    }
+    char* region = reinterpret_cast<char*>(aligned);
+#ifdef MADV_HUGEPAGE
+    madvise(region, region_size, MADV_HUGEPAGE);   // 失败时（内核未开启透明大页）仍可按普通页使用
+#endif
+    return region;
+}
+
+/**
+ * @brief 按当前模式映射一个区域
+ * @param mode 内存来源
+ * @return 区域地址，失败时返回 nullptr
+ */
+static char* MapRegion(RpcPageArena::Mode mode) {
+#ifdef MAP_HUGETLB
+    static std::atomic<int64_t>& hugetlb_fallbacks = RpcMetrics::GetInstance().Counter("provider.huge_page_hugetlb_fallbacks");
+    static std::atomic<bool> hugetlb_warned{false};
+
+    if (mode == RpcPageArena::Mode::HugeTlb) {
+        void* mapped = mmap(nullptr, RpcPageArena::kRegionSize, PROT_READ | PROT_WRITE,
+                            MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+        if (mapped != MAP_FAILED) {
+            return static_cast<char*>(mapped);
+        }
+        // 没有预留足够的大页，退回透明大页（与退回 operator new 分开计数，只提示一次）
+        int err = errno;
+        hugetlb_fallbacks.fetch_add(1, std::memory_order_relaxed);
+        if (!hugetlb_warned.exchange(true, std::memory_order_relaxed)) {
+            std::cerr << "RpcPageArena: MAP_HUGETLB failed (" << std::strerror(err)
+                      << "), fall back to transparent huge pages" << std::endl;
+        }
+    }
+#endif
+    return MapTransparentRegion();
+}
+
+void RpcPageArena::SetMode(Mode mode) {
+    pageArenaMode.store(static_cast<int>(mode), std::memory_order_relaxed);
+}
+
+RpcPageArena::Mode RpcPageArena::ParseMode(const std::string& name) {
+    if (name == "thp") {
+        return Mode::Transparent;
+    }
+    if (name == "hugetlb") {
+        return Mode::HugeTlb;
+    }
+    if (name != "off") {
+        std::cerr << "RpcPageArena: unknown huge page mode " << name << ", use off" << std::endl;
+    }
+    return Mode::Off;
+}
+
+void* RpcPageArena::Allocate(size_t size, bool* in_region) {
+    static std::atomic<int64_t>& regions = RpcMetrics::GetInstance().Counter("provider.huge_page_regions");
+    static std::atomic<int64_t>& fallbacks = RpcMetrics::GetInstance().Counter("provider.huge_page_fallbacks");
+    static PageArenaState* state = new PageArenaState;  // 进程退出时不析构，区域中的 slab 可能仍在使用
+
+    *in_region = false;
+    Mode mode = static_cast<Mode>(pageArenaMode.load(std::memory_order_relaxed));
+    if (mode == Mode::Off || size > kRegionSize) {
+        return ::operator new(size);
+    }
+
+    size = (size + alignof(std::max_align_t) - 1) / alignof(std::max_align_t) * alignof(std::max_align_t);
+    std::lock_guard<std::mutex> lock(state->mutex_);
+    if (state->region_ == nullptr || kRegionSize - state->used_ < size) {
+        char* region = MapRegion(mode);
+        if (region == nullptr) {
+            fallbacks.fetch_add(1, std::memory_order_relaxed);
+            return ::operator new(size);
+        }
+        regions.fetch_add(1, std::memory_order_relaxed);
+        state->region_ = region;
+        state->used_ = 0;
+    }
+    void* slab = state->region_ + state->used_;
+    state->used_ += size;
+    *in_region = true;
+    return slab;
+}
+
+RpcSlabPool::RpcSlabPool(size_t block_size, size_t blocks_per_slab)
+    : blockSize_((block_size + alignof(std::max_align_t) - 1) / alignof(std::max_align_t) * alignof(std::max_align_t)),
+      blocksPerSlab_(blocks_per_slab > 0 ? blocks_per_slab : 1) {}
+
+RpcSlabPool::~RpcSlabPool() {
+    for (void* slab : slabs_) {
+        ::operator delete(slab);
+    }
+}
+
+void* RpcSlabPool::Allocate() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (free_.empty()) {
+        bool in_region = false;
+        char* slab = static_cast<char*>(RpcPageArena::Allocate(blockSize_ * blocksPerSlab_, &in_region));
+        if (!in_region) {
+            slabs_.push_back(slab);
+        }
+        ++slabCount_;
+        free_.reserve(slabCount_ * blocksPerSlab_);     // 释放时不会扩容
+        // 倒序放入，先分配低地址的块
+        for (size_t i = blocksPerSlab_; i > 0; --i) {
+            free_.push_back(slab + (i - 1) * blockSize_);
+        }
+    }
+    void* block = free_.back();
+    free_.pop_back();
+    return block;
+}
+
+void RpcSlabPool::Deallocate(void* block) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    free_.push_back(block);
+}
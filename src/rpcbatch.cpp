@@ -0,0 +1,147 @@
+#include "rpcbatch.h"
+#include "rpcheader.pb.h"
+#include <arpa/inet.h>
+#include <cstring>
+
+RpcBatch::RpcBatch(RpcChannel* channel)
+    : channel_(channel) {
+}
+
+void RpcBatch::Add(const google::protobuf::MethodDescriptor* method,
+                   const google::protobuf::Message* request,
+                   google::protobuf::Message* response,
+                   google::protobuf::RpcController* controller) {
+    items_.push_back(Item{method, request, response, controller});
+}
+
+void RpcBatch::SetTenant(const std::string& tenant) {
+    controller_.SetTenant(tenant);
+}
+
+void RpcBatch::Clear() {
+    items_.clear();
+    controller_.Reset();    // 保留租户标识
+}
+
+void RpcBatch::Send(google::protobuf::Closure* done) {
+    if (items_.empty()) {
+        if (done) {
+            done->Run();
+        }
+        return;
+    }
+
+    /**
+     * 批量请求的字符流:
+     * 1.数据头的长度 header_size (4字节)
+     * 2.数据头 header_str: args_size + request_id + tenant + batch_count
+     * 3.请求参数: 依次拼接的子请求字符流，子请求的 request_id 为其在批量请求中的下标
+     */
+    std::string args_str;
+    for (size_t i = 0; i < items_.size(); ++i) {
+        if (!RpcChannel::SerializeRequest(items_[i].method_, items_[i].controller_, items_[i].request_, i, 0, &args_str)) {
+            controller_.SetFailed("batch item " + std::to_string(i) + " serialize failed!");
+            Finish(done);
+            return;
+        }
+    }
+
+    // 批量请求不分块发送：超过本端或服务端在握手中声明的上限时只让这个批量请求失败，
+    // 发出去会被服务端当作格式错误而关闭连接，共享该连接的其他调用也会随之失败
+    RpcConnection* connection = channel_->GetConnection();
+    size_t max_message_size = channel_->maxMessageSize_;
+    uint64_t peer_max = connection->PeerMaxMessageSize();
+    if (peer_max != 0 && peer_max < max_message_size) {
+        max_message_size = peer_max;
+    }
+    if (args_str.size() > max_message_size) {
+        controller_.SetFailed("batch request exceeds max message size!");
+        Finish(done);
+        return;
+    }
+
+    uint64_t request_id = channel_->nextRequestId_++;
+    rpcheader::RpcHeader rpcheader;
+    rpcheader.set_args_size(args_str.size());
+    rpcheader.set_request_id(request_id);
+    rpcheader.set_tenant(controller_.GetTenant());
+    rpcheader.set_batch_count(items_.size());
+
+    std::string header_str;
+    if (!rpcheader.SerializeToString(&header_str)) {
+        controller_.SetFailed("rpcheader SerializeToString failed!");
+        Finish(done);
+        return;
+    }
+    uint32_t header_size = htonl(header_str.size());
+
+    std::string send_buf;
+    send_buf.reserve(4 + header_str.size() + args_str.size());
+    send_buf.append((char*)&header_size, 4);
+    send_buf.append(header_str);
+    send_buf.append(args_str);
+
+    RpcConnection::BodyParser parser = [this](const char* body, size_t size) {
+        return ParseResponses(body, size);
+    };
+    if (done) {
+        google::protobuf::Closure* finish = google::protobuf::NewCallback(this, &RpcBatch::Finish, done);
+        connection->Call(request_id, std::move(send_buf), std::move(parser), &controller_, finish);
+    } else {
+        connection->Call(request_id, std::move(send_buf), std::move(parser), &controller_, nullptr);
+        Finish(nullptr);
+    }
+}
+
+std::string RpcBatch::ParseResponses(const char* body, size_t size) {
+    size_t offset = 0;
+    for (size_t i = 0; i < items_.size(); ++i) {
+        // 子响应: 4字节 header_size + 数据头 + 响应消息体
+        if (size - offset < 4) {
+            return "batch response truncated!";
+        }
+        uint32_t header_size = 0;
+        memcpy(&header_size, body + offset, 4);
+        header_size = ntohl(header_size);
+        if (size - offset - 4 < header_size) {
+            return "batch response truncated!";
+        }
+        rpcheader::RpcResponseHeader header;
+        if (!header.ParseFromArray(body + offset + 4, header_size)) {
+            return "ParseFromString batch response header failed!";
+        }
+        if (size - offset - 4 - header_size < header.body_size() || header.request_id() != i) {
+            return "batch response mismatch!";
+        }
+        const char* response_body = body + offset + 4 + header_size;
+        offset += 4 + header_size + header.body_size();
+
+        const Item& item = items_[i];
+        if (header.status() != rpcheader::RPC_OK) {
+            if (item.controller_) {
+                item.controller_->SetFailed(header.error_text());
+            }
+        } else if (!item.response_->ParseFromArray(response_body, header.body_size())) {
+            if (item.controller_) {
+                item.controller_->SetFailed("ParseFromString response failed!");
+            }
+        }
+    }
+    if (offset != size) {
+        return "batch response mismatch!";
+    }
+    return "";
+}
+
+void RpcBatch::Finish(google::protobuf::Closure* done) {
+    if (controller_.Failed()) {
+        for (const Item& item : items_) {
+            if (item.controller_) {
+                item.controller_->SetFailed(controller_.ErrorText());
+            }
+        }
+    }
+    if (done) {
+        done->Run();
+    }
+}
@@ -0,0 +1,96 @@
+#include "rpcbufferpool.h"
+#include <utility>
+#include <vector>
+#include "rpcallocator.h"
+
+static constexpr size_t kMaxCachedPerClass = 4;     // 每个线程每一级缓存的缓冲区数上限
+static constexpr size_t kSlabBytes = 256 * 1024;    // 每个 slab 的长度
+
+/**
+ * @brief 每一级缓冲区的 slab 池（进程退出时不析构，线程缓存可能晚于它释放）
+ * @param size_class 级别
+ * @return slab 池
+ */
+static RpcSlabPool& SlabPool(int size_class) {
+    static RpcSlabPool* pools[RpcBufferPool::kClasses] = {
+        new RpcSlabPool(RpcBufferPool::ClassSize(0), kSlabBytes / RpcBufferPool::ClassSize(0)),
+        new RpcSlabPool(RpcBufferPool::ClassSize(1), kSlabBytes / RpcBufferPool::ClassSize(1)),
+        new RpcSlabPool(RpcBufferPool::ClassSize(2), kSlabBytes / RpcBufferPool::ClassSize(2)),
+        new RpcSlabPool(RpcBufferPool::ClassSize(3), kSlabBytes / RpcBufferPool::ClassSize(3)),
+        new RpcSlabPool(RpcBufferPool::ClassSize(4), kSlabBytes / RpcBufferPool::ClassSize(4)),
+    };
+    return *pools[size_class];
+}
+
+/**
+ * @brief 一个线程每一级的空闲缓冲区；线程退出时归还给 slab 池
+ */
+struct BufferPoolCaches {
+    ~BufferPoolCaches() {
+        for (int i = 0; i < RpcBufferPool::kClasses; ++i) {
+            for (char* data : caches_[i]) {
+                SlabPool(i).Deallocate(data);
+            }
+        }
+    }
+
+    std::vector<char*> caches_[RpcBufferPool::kClasses];
+};
+
+static thread_local BufferPoolCaches bufferCaches;
+
+int RpcBufferPool::ClassOf(size_t size) {
+    int size_class = 0;
+    while (size_class < kClasses - 1 && ClassSize(size_class) < size) {
+        ++size_class;
+    }
+    return size_class;
+}
+
+RpcBufferPool::Buffer RpcBufferPool::Acquire(size_t size) {
+    int size_class = ClassOf(size);
+    std::vector<char*>& cache = bufferCaches.caches_[size_class];
+    char* data = nullptr;
+    if (cache.empty()) {
+        data = static_cast<char*>(SlabPool(size_class).Allocate());
+    } else {
+        data = cache.back();
+        cache.pop_back();
+    }
+    return Buffer(data, ClassSize(size_class), size_class);
+}
+
+void RpcBufferPool::Release(char* data, int size_class) {
+    std::vector<char*>& cache = bufferCaches.caches_[size_class];
+    if (cache.size() >= kMaxCachedPerClass) {
+        SlabPool(size_class).Deallocate(data);
+        return;
+    }
+    if (cache.capacity() == 0) {
+        cache.reserve(kMaxCachedPerClass);  // 归还时不会扩容
+    }
+    cache.push_back(data);
+}
+
+RpcBufferPool::Buffer::Buffer(Buffer&& other) noexcept
+    : data_(std::exchange(other.data_, nullptr)),
+      size_(std::exchange(other.size_, 0)),
+      class_(std::exchange(other.class_, -1)) {}
+
+RpcBufferPool::Buffer& RpcBufferPool::Buffer::operator=(Buffer&& other) noexcept {
+    if (this != &other) {
+        if (data_ != nullptr) {
+            RpcBufferPool::Release(data_, class_);
+        }
+        data_ = std::exchange(other.data_, nullptr);
+        size_ = std::exchange(other.size_, 0);
+        class_ = std::exchange(other.class_, -1);
+    }
+    return *this;
+}
+
+RpcBufferPool::Buffer::~Buffer() {
+    if (data_ != nullptr) {
+        RpcBufferPool::Release(data_, class_);
+    }
+}
@@ -1,96 +1,323 @@
 #include "rpcchannel.h"
 #include <google/protobuf/descriptor.h>
 #include "rpcheader.pb.h"
+#include "rpcoptions.pb.h"
 #include "rpcapplication.h"
 #include "rpccontroller.h"
-#include <boost/asio.hpp>
+#include "rpccompress.h"
+#include "rpcframe.h"
+
+RpcChannel::RpcChannel()
+    : RpcChannel(RpcApplication::GetConfig().Load<int>("rpc.client.cork_us", 0)) {
+}
+
+RpcChannel::RpcChannel(int cork_us)
+    : corkUs_(cork_us),
+      streamWindow_(RpcApplication::GetConfig().Load<int>("stream.window", 16)),
+      chunkSize_(RpcApplication::GetConfig().Load<size_t>("rpc.chunk_size", 64 * 1024)),
+      maxMessageSize_(RpcApplication::GetConfig().Load<size_t>("rpc.max_message_size", 64 * 1024 * 1024)),
+      checksum_(RpcApplication::GetConfig().Load<bool>("rpc.checksum", false)),
+      fixedHeader_(RpcApplication::GetConfig().Load<bool>("rpc.client.fixed_header", true)) {
+}
+
+/**
+ * @brief 组装流式调用中客户端发送的帧：数据头（frame_type + request_id + credit + args_size）+ 消息体
+ * @param type 帧类型（流中的消息、授信、结束发送或中止）
+ * @param request_id 流式调用的请求id
+ * @param credit 授信帧中追加的额度
+ * @param body 消息体
+ * @param fixed 是否使用定长数据头
+ * @return 帧
+ */
+static std::string BuildStreamFrame(rpcheader::FrameType type, uint64_t request_id, uint32_t credit,
+                                    const std::string& body, bool fixed) {
+    rpcheader::RpcHeader header;
+    header.set_frame_type(type);
+    header.set_request_id(request_id);
+    header.set_credit(credit);
+    header.set_args_size(body.size());
+
+    std::string frame;
+    frame.reserve(RpcFrame::kFixedHeaderSize + 16 + body.size());
+    RpcFrame::AppendRequestHeader(header, fixed, &frame);
+    frame.append(body);
+    return frame;
+}
 
 void RpcChannel::CallMethod(const google::protobuf::MethodDescriptor* method,
                            google::protobuf::RpcController* controller,
                            const google::protobuf::Message* request,
                            google::protobuf::Message* response,
                            google::protobuf::Closure* done) {
+    rpcoptions::StreamingMode streaming_mode = method->options().GetExtension(rpcoptions::streaming);
+    bool streaming = streaming_mode != rpcoptions::STREAMING_NONE;
+    RpcController* rpc_controller = dynamic_cast<RpcController*>(controller);
+    if (streaming && !rpc_controller) {
+        // 流式调用通过 RpcController 获取消息流
+        if (controller) {
+            controller->SetFailed("streaming call requires RpcController!");
+        }
+        if (done) {
+            done->Run();
+        }
+        return;
+    }
 
-    const google::protobuf::ServiceDescriptor* sd = method->service();  // 获取服务描述符
-    std::string service_name = sd->name();                      // 获取服务名称
-    std::string method_name = method->name();                    // 获取方法名称
+    uint64_t request_id = nextRequestId_++;
+    bool one_way = method->options().GetExtension(rpcoptions::one_way);
+
+    // 超长（超过本端或服务端在握手中声明的上限）的请求在本地直接失败；一元调用的大请求分块发送，请求参数只序列化一次
+    RpcConnection* connection = GetConnection();
+    size_t max_message_size = maxMessageSize_;
+    uint64_t peer_max = connection->PeerMaxMessageSize();
+    if (peer_max != 0 && peer_max < max_message_size) {
+        max_message_size = peer_max;
+    }
+    size_t args_size = request->ByteSizeLong();
+    if (args_size > max_message_size) {
+        if (controller) {
+            controller->SetFailed("request exceeds max message size!");
+        }
+        if (done) {
+            done->Run();
+        }
+        return;
+    }
 
+    // 服务端支持的压缩算法和定长数据头在收到握手回复之后才知道，此前的请求不压缩、使用带名字的 protobuf 数据头
+    RpcCompressor& compressor = RpcCompressor::GetInstance();
+    uint32_t peer_mask = connection->PeerCompression();
+    MethodRef ref;
+    // 在服务端哈希冲突的方法id无法分发，这些方法改用带名字的数据头
+    ref.fixed = fixedHeader_ && connection->PeerFrameVersion() >= RpcFrame::kVersion &&
+                !connection->PeerAmbiguousMethod(method);
+    bool fixed = ref.fixed;
+    // 不使用定长数据头时，名字在每条连接上只发送一次，之后只带连接内的序号
+    uint64_t intern_epoch = 0;
+    if (!ref.fixed && connection->PeerFrameVersion() > 0) {
+        ref.index = connection->InternMethod(method, &ref.indexOnly, &intern_epoch);
+    }
+    bool defining = ref.index != 0 && !ref.indexOnly;
+    // 帧入队前连接断开或重连过时，连接把序号改为名字
+    const google::protobuf::MethodDescriptor* interned = ref.index != 0 ? method : nullptr;
+    bool compress = !streaming && compressor.WouldCompress(method, args_size, peer_mask);
+    bool chunked = !streaming && !one_way && chunkSize_ > 0 && args_size > chunkSize_;
+
+    std::string send_buf;
+    if (compress || chunked) {
+        std::string body;
+        if (!request->SerializeToString(&body)) {
+            if (controller) {
+                controller->SetFailed("request SerializeToString failed!");
+            }
+            if (done) {
+                done->Run();
+            }
+            return;
+        }
+        int compression = compress ? compressor.Compress(method, peer_mask, &body) : rpcheader::COMPRESS_NONE;
+        if (!one_way && chunkSize_ > 0 && body.size() > chunkSize_) {
+            std::unique_ptr<ChunkedFrame> frame =
+                BuildChunkedRequest(method, controller, request_id, std::move(body), compression, args_size, fixed);
+            if (!frame) {
+                if (done) {
+                    done->Run();
+                }
+                return;
+            }
+            connection->Call(request_id, std::move(frame), response, controller, done);
+            return;
+        }
+        if (!EncodeRequestHeader(method, controller, request_id, 0, body.size(), &send_buf, compression, args_size, ref)) {
+            if (done) {
+                done->Run();
+            }
+            return;
+        }
+        send_buf.append(body);
+    } else if (!SerializeRequest(method, controller, request, request_id, streaming ? streamWindow_ : 0, &send_buf, ref)) {
+        if (done) {
+            done->Run();
+        }
+        return;
+    }
+
+    // ==================== 通过网络发送rpc请求 ====================
+    // 单向方法：请求帧进入发送队列后立即返回，服务端不会发送响应，response 保持不变
+    if (one_way) {
+        std::string error;
+        if (!connection->Send(std::move(send_buf), &error, interned, intern_epoch) && controller) {
+            controller->SetFailed(error);
+        }
+        if (defining) {
+            connection->ConfirmMethod(method, intern_epoch);
+        }
+        if (done) {
+            done->Run();
+        }
+        return;
+    }
+
+    // 流式方法：CallMethod 立即返回，通过 controller->GetStream() 收发消息，调用结束后执行 done；
+    // 流的帧与其他调用共享连接的发送队列，客户端发送消息的额度来自服务端的授信
+    if (streaming) {
+        RpcStream::MessageSender send_message;
+        RpcStream::EndSender send_end;
+        if (streaming_mode == rpcoptions::STREAMING_CLIENT || streaming_mode == rpcoptions::STREAMING_BIDI) {
+            send_message = [connection, request_id, fixed](std::string message) {
+                std::string error;
+                connection->Send(BuildStreamFrame(rpcheader::FRAME_STREAM_MESSAGE, request_id, 0, message, fixed), &error);
+            };
+            send_end = [connection, request_id, fixed]() {
+                std::string error;
+                connection->Send(BuildStreamFrame(rpcheader::FRAME_STREAM_END, request_id, 0, "", fixed), &error);
+            };
+        }
+        auto stream = std::make_shared<RpcStream>(
+            streamWindow_,
+            std::move(send_message),
+            [connection, request_id, fixed](uint32_t credit) {
+                std::string error;
+                connection->Send(BuildStreamFrame(rpcheader::FRAME_STREAM_CREDIT, request_id, credit, "", fixed), &error);
+            },
+            std::move(send_end),
+            [connection, request_id, fixed]() {
+                std::string error;
+                connection->Send(BuildStreamFrame(rpcheader::FRAME_STREAM_RESET, request_id, 0, "", fixed), &error);
+            });
+        rpc_controller->SetStream(stream);
+        connection->CallStream(request_id, std::move(send_buf), stream, response, controller, done, interned, intern_epoch);
+        if (defining) {
+            connection->ConfirmMethod(method, intern_epoch);
+        }
+        return;
+    }
+
+    // 请求帧进入连接的发送队列，与其他并发调用的请求合并发送；响应按 request_id 匹配
+    // （同步调用返回时已收到响应，异步调用返回时请求帧已入队，两种情况下登记帧都已在之后的请求之前发出）
+    connection->Call(request_id, std::move(send_buf), response, controller, done, interned, intern_epoch);
+    if (defining) {
+        connection->ConfirmMethod(method, intern_epoch);
+    }
+}
+
+bool RpcChannel::SerializeRequest(const google::protobuf::MethodDescriptor* method,
+                                  google::protobuf::RpcController* controller,
+                                  const google::protobuf::Message* request,
+                                  uint64_t request_id,
+                                  uint32_t credit,
+                                  std::string* frame,
+                                  const MethodRef& ref) {
     // ==================== 组织rpc请求的字符流 ====================
     /**
      * 将 rpc 方法调用请求发送给远程的 rpc 服务端，然后等待 rpc 服务端返回响应结果 
      * 发送的字符流包含的信息：
-     * 1.数据头的长度 header_size (4字节)
-     * 2.数据头 header_str: service_name + method_name + args_size (header_size字节)
-     * 3.请求参数 args_str  (args_size字节)
+     * 1.数据头：4字节 header_size + protobuf 数据头（service_name + method_name 或 method_index + args_size + request_id + tenant），
+     *   或定长数据头（method_id + args_size + request_id + 扩展数据头），见 rpcframe.h
+     * 2.请求参数 args_str  (args_size字节)
      */
-                    
-    std::string args_str;   // 存储序列化后的请求参数
-    // 序列化请求参数
-    if (!request->SerializeToString(&args_str)) {
+    size_t args_size = request->ByteSizeLong();
+    if (!EncodeRequestHeader(method, controller, request_id, credit, args_size, frame, 0, 0, ref)) {
+        return false;
+    }
+
+    // 请求参数直接序列化到帧的末尾，不经过中间字符串
+    size_t args_offset = frame->size();
+    frame->resize(args_offset + args_size);
+    if (!request->SerializeToArray(&(*frame)[args_offset], args_size)) {
         // 序列化请求参数失败
-        controller->SetFailed("request SerializeToString failed!");
-        return;
+        if (controller) {
+            controller->SetFailed("request SerializeToString failed!");
+        }
+        return false;
     }
+    return true;
+}
+
+bool RpcChannel::EncodeRequestHeader(const google::protobuf::MethodDescriptor* method,
+                                     google::protobuf::RpcController* controller,
+                                     uint64_t request_id,
+                                     uint32_t credit,
+                                     size_t args_size,
+                                     std::string* frame,
+                                     int compression,
+                                     size_t uncompressed_size,
+                                     const MethodRef& ref) {
+    const google::protobuf::ServiceDescriptor* sd = method->service();  // 获取服务描述符
 
     // 构建RPC数据头
     rpcheader::RpcHeader rpcheader;
-    rpcheader.set_service_name(service_name);   // service_name
-    rpcheader.set_method_name(method_name);     // method_name
-    rpcheader.set_args_size(args_str.size());   // args_size
-
-    std::string header_str; // 存储序列化后的数据头
-    if (!rpcheader.SerializeToString(&header_str)) {
-        controller->SetFailed("rpcheader SerializeToString failed!");
-        return;
+    if (ref.fixed) {
+        rpcheader.set_method_id(RpcFrame::MethodId(method));    // method_id 代替服务名和方法名
+    } else {
+        if (!ref.indexOnly) {
+            rpcheader.set_service_name(sd->name());     // service_name
+            rpcheader.set_method_name(method->name());  // method_name
+        }
+        rpcheader.set_method_index(ref.index);      // 连接内的序号，与名字同时出现时登记
+    }
+    rpcheader.set_args_size(args_size);         // args_size
+    rpcheader.set_request_id(request_id);       // request_id
+    rpcheader.set_one_way(method->options().GetExtension(rpcoptions::one_way));    // one_way
+    rpcheader.set_credit(credit);               // 流式调用的初始接收窗口
+    if (compression != rpcheader::COMPRESS_NONE) {
+        rpcheader.set_compression(static_cast<rpcheader::CompressionType>(compression));
+        rpcheader.set_uncompressed_size(uncompressed_size);
+    }
+    RpcController* rpc_controller = dynamic_cast<RpcController*>(controller);
+    if (rpc_controller) {
+        rpcheader.set_tenant(rpc_controller->GetTenant());  // tenant
+        rpcheader.set_timeout_ms(rpc_controller->GetTimeout()); // timeout_ms
+        const std::string& metadata = rpc_controller->OutgoingMetadata();
+        if (metadata.size() > RpcFrame::kMaxMetadataSize) {
+            controller->SetFailed("request metadata exceeds max size!");
+            return false;
+        }
+        rpcheader.set_metadata(metadata);   // metadata
     }
 
-    // 数据头的长度
-    uint32_t header_size = htonl(header_str.size());  // 主机字节序转网络字节序
+    // 组装发送数据：数据头，请求参数由调用方追加
+    RpcFrame::AppendRequestHeader(rpcheader, ref.fixed, frame);
+    return true;
+}
 
-    // 组装发送数据
-    std::string send_buf;
-    send_buf.append((char*)&header_size, 4);    // 1. 四字节的 header_size
-    send_buf.append(header_str);                // 2. 数据头 header_str ：service_name + method_name + args_size
-    send_buf.append(args_str);                   // 3. 请求参数 args_str
-    // ============================================================
+std::unique_ptr<ChunkedFrame> RpcChannel::BuildChunkedRequest(const google::protobuf::MethodDescriptor* method,
+                                                              google::protobuf::RpcController* controller,
+                                                              uint64_t request_id,
+                                                              std::string body,
+                                                              int compression,
+                                                              size_t uncompressed_size,
+                                                              bool fixed) {
+    // 最终帧：完整的数据头（包括压缩信息），请求参数为最后一块
+    std::string final_header;
+    MethodRef ref;
+    ref.fixed = fixed;
+    if (!EncodeRequestHeader(method, controller, request_id, 0, ChunkedFrame::LastChunkSize(body.size(), chunkSize_),
+                             &final_header, compression, uncompressed_size, ref)) {
+        return nullptr;
+    }
 
-    // ==================== 通过网络发送rpc请求 ====================
-    // 读取配置
-    std::string ip = RpcApplication::GetConfig().Load<std::string>("rpc.server_ip");
-    uint16_t port = RpcApplication::GetConfig().Load<int>("rpc.server_port");
-
-    // 使用Boost.Asio发起网络请求
-    try {
-        // 使用ASIO进行网络通信
-        boost::asio::io_context io_context; // 创建IO上下文
-        boost::asio::ip::tcp::socket socket(io_context);    // 创建TCP套接字
-        boost::asio::ip::tcp::resolver resolver(io_context);    // 创建解析器
-
-        // 连接服务器
-        boost::asio::ip::tcp::resolver::results_type endpoints = resolver.resolve(ip, std::to_string(port));    // 解析服务器地址和端口
-        boost::asio::connect(socket, endpoints);    // 连接服务器
-
-        // 发送请求
-        boost::asio::write(socket, boost::asio::buffer(send_buf));    // 发送请求数据(write 会阻塞直到数据发送完毕)
-
-        // 接收响应 - 使用长度前缀方式避免消息边界问题
-        // 1. 先读取4字节的响应长度
-        uint32_t response_len = 0;
-        boost::asio::read(socket, boost::asio::buffer(&response_len, sizeof(response_len)));
-        response_len = ntohl(response_len);  // 网络字节序转主机字节序
-
-        // 2. 根据长度读取完整的响应消息体
-        std::vector<char> response_body(response_len);
-        boost::asio::read(socket, boost::asio::buffer(response_body));
-
-        // 解析响应
-        std::string response_str(response_body.data(), response_len);
-        if (!response->ParseFromString(response_str)) {
-            controller->SetFailed("ParseFromString response failed!");
-            return;
-        }
+    // 分块帧：数据头只有 frame_type + request_id + args_size
+    rpcheader::RpcHeader header;
+    header.set_frame_type(rpcheader::FRAME_CHUNK);
+    header.set_request_id(request_id);
+    header.set_args_size(chunkSize_);
+    std::string chunk_header;
+    RpcFrame::AppendRequestHeader(header, fixed, &chunk_header);
 
-    } catch (std::exception& e) {
-        controller->SetFailed("RPC call exception: " + std::string(e.what()));
-    }
-}
\ No newline at end of file
+    return std::unique_ptr<ChunkedFrame>(
+        new ChunkedFrame(std::move(chunk_header), std::move(final_header), std::move(body), chunkSize_));
+}
+
+RpcConnection* RpcChannel::GetConnection() {
+    std::call_once(connectionOnce_, [this]() {
+        RpcConnection::Options options;
+        options.ip = RpcApplication::GetConfig().Load<std::string>("rpc.server_ip");
+        options.port = RpcApplication::GetConfig().Load<int>("rpc.server_port");
+        options.cork_us = corkUs_;
+        options.max_message_size = maxMessageSize_;
+        options.checksum = checksum_;
+        connection_.reset(new RpcConnection(options));
+    });
+    return connection_.get();
+}
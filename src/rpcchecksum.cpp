@@ -0,0 +1,252 @@
+#include "rpcchecksum.h"
+#include "rpcframe.h"
+#include <arpa/inet.h>
+#include <cstring>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <nmmintrin.h>
+#define RPC_CRC32C_SSE42 1
+#endif
+
+static const uint32_t kPolynomial = 0x82f63b78;     // CRC32C 多项式（反射形式）
+static const size_t kLongBlock = 8192;              // 三路交错计算的长块
+static const size_t kShortBlock = 256;              // 三路交错计算的短块
+
+/**
+ * @brief GF(2) 上 32x32 矩阵乘以向量
+ */
+static uint32_t Gf2MatrixTimes(const uint32_t* mat, uint32_t vec) {
+    uint32_t sum = 0;
+    while (vec) {
+        if (vec & 1) {
+            sum ^= *mat;
+        }
+        vec >>= 1;
+        mat++;
+    }
+    return sum;
+}
+
+/**
+ * @brief GF(2) 上 32x32 矩阵求平方
+ */
+static void Gf2MatrixSquare(uint32_t* square, const uint32_t* mat) {
+    for (int n = 0; n < 32; n++) {
+        square[n] = Gf2MatrixTimes(mat, mat[n]);
+    }
+}
+
+/**
+ * @brief CRC32C 查找表
+ *        slicing_ 用于查表法；longShift_ / shortShift_ 把一段数据的 CRC 前移 kLongBlock / kShortBlock 个零字节，
+ *        用于合并三路交错计算的结果
+ */
+struct Crc32cTables {
+    uint32_t slicing_[8][256];
+    uint32_t longShift_[4][256];
+    uint32_t shortShift_[4][256];
+
+    Crc32cTables() {
+        for (uint32_t n = 0; n < 256; n++) {
+            uint32_t crc = n;
+            for (int k = 0; k < 8; k++) {
+                crc = crc & 1 ? (crc >> 1) ^ kPolynomial : crc >> 1;
+            }
+            slicing_[0][n] = crc;
+        }
+        for (uint32_t n = 0; n < 256; n++) {
+            uint32_t crc = slicing_[0][n];
+            for (int k = 1; k < 8; k++) {
+                crc = slicing_[0][crc & 0xff] ^ (crc >> 8);
+                slicing_[k][n] = crc;
+            }
+        }
+        BuildShift(longShift_, kLongBlock);
+        BuildShift(shortShift_, kShortBlock);
+    }
+
+    /**
+     * @brief 构造前移 len 个零字节的查找表（len 为 2 的幂）
+     */
+    static void BuildShift(uint32_t table[4][256], size_t len) {
+        uint32_t even[32];  // 偶数次幂的零比特算子
+        uint32_t odd[32];   // 奇数次幂的零比特算子
+
+        // 一个零比特的算子
+        odd[0] = kPolynomial;
+        uint32_t row = 1;
+        for (int n = 1; n < 32; n++) {
+            odd[n] = row;
+            row <<= 1;
+        }
+        Gf2MatrixSquare(even, odd);     // 两个零比特
+        Gf2MatrixSquare(odd, even);     // 四个零比特
+        // 反复平方，直到得到 len 个零字节的算子
+        const uint32_t* op = nullptr;
+        do {
+            Gf2MatrixSquare(even, odd);
+            len >>= 1;
+            op = even;
+            if (len == 0) {
+                break;
+            }
+            Gf2MatrixSquare(odd, even);
+            len >>= 1;
+            op = odd;
+        } while (len);
+
+        for (uint32_t n = 0; n < 256; n++) {
+            table[0][n] = Gf2MatrixTimes(op, n);
+            table[1][n] = Gf2MatrixTimes(op, n << 8);
+            table[2][n] = Gf2MatrixTimes(op, n << 16);
+            table[3][n] = Gf2MatrixTimes(op, n << 24);
+        }
+    }
+};
+
+static const Crc32cTables& Tables() {
+    static const Crc32cTables tables;
+    return tables;
+}
+
+static uint32_t Shift(const uint32_t table[4][256], uint32_t crc) {
+    return table[0][crc & 0xff] ^ table[1][(crc >> 8) & 0xff] ^ table[2][(crc >> 16) & 0xff] ^ table[3][crc >> 24];
+}
+
+/**
+ * @brief 查表法（slicing-by-8），crc 为未取反的中间值
+ */
+static uint32_t Crc32cTable(uint32_t crc, const unsigned char* next, size_t len) {
+    const Crc32cTables& tables = Tables();
+    while (len && (reinterpret_cast<uintptr_t>(next) & 7) != 0) {
+        crc = tables.slicing_[0][(crc ^ *next++) & 0xff] ^ (crc >> 8);
+        len--;
+    }
+    while (len >= 8) {
+        uint64_t word;
+        memcpy(&word, next, 8);     // 按小端序处理
+        word ^= crc;
+        crc = tables.slicing_[7][word & 0xff] ^
+              tables.slicing_[6][(word >> 8) & 0xff] ^
+              tables.slicing_[5][(word >> 16) & 0xff] ^
+              tables.slicing_[4][(word >> 24) & 0xff] ^
+              tables.slicing_[3][(word >> 32) & 0xff] ^
+              tables.slicing_[2][(word >> 40) & 0xff] ^
+              tables.slicing_[1][(word >> 48) & 0xff] ^
+              tables.slicing_[0][word >> 56];
+        next += 8;
+        len -= 8;
+    }
+    while (len) {
+        crc = tables.slicing_[0][(crc ^ *next++) & 0xff] ^ (crc >> 8);
+        len--;
+    }
+    return crc;
+}
+
+#ifdef RPC_CRC32C_SSE42
+/**
+ * @brief crc32 指令每条延迟 3 个周期、吞吐 1 条/周期：把一块数据分成连续的三段同时计算，
+ *        再用前移表把前两段的结果合并到第三段
+ */
+__attribute__((target("sse4.2")))
+static uint32_t Crc32cBlocks(uint32_t crc0, const unsigned char*& next, size_t& len,
+                             size_t block, const uint32_t shift[4][256]) {
+    while (len >= block * 3) {
+        uint64_t crc1 = 0;
+        uint64_t crc2 = 0;
+        uint64_t c0 = crc0;
+        const unsigned char* end = next + block;
+        do {
+            uint64_t a, b, c;
+            memcpy(&a, next, 8);
+            memcpy(&b, next + block, 8);
+            memcpy(&c, next + 2 * block, 8);
+            c0 = _mm_crc32_u64(c0, a);
+            crc1 = _mm_crc32_u64(crc1, b);
+            crc2 = _mm_crc32_u64(crc2, c);
+            next += 8;
+        } while (next < end);
+        crc0 = Shift(shift, static_cast<uint32_t>(c0)) ^ static_cast<uint32_t>(crc1);
+        crc0 = Shift(shift, crc0) ^ static_cast<uint32_t>(crc2);
+        next += block * 2;
+        len -= block * 3;
+    }
+    return crc0;
+}
+
+/**
+ * @brief SSE4.2 实现，crc 为未取反的中间值
+ */
+__attribute__((target("sse4.2")))
+static uint32_t Crc32cHardware(uint32_t crc, const unsigned char* next, size_t len) {
+    while (len && (reinterpret_cast<uintptr_t>(next) & 7) != 0) {
+        crc = _mm_crc32_u8(crc, *next++);
+        len--;
+    }
+    const Crc32cTables& tables = Tables();
+    crc = Crc32cBlocks(crc, next, len, kLongBlock, tables.longShift_);
+    crc = Crc32cBlocks(crc, next, len, kShortBlock, tables.shortShift_);
+
+    uint64_t c = crc;
+    while (len >= 8) {
+        uint64_t word;
+        memcpy(&word, next, 8);
+        c = _mm_crc32_u64(c, word);
+        next += 8;
+        len -= 8;
+    }
+    crc = static_cast<uint32_t>(c);
+    while (len) {
+        crc = _mm_crc32_u8(crc, *next++);
+        len--;
+    }
+    return crc;
+}
+#endif
+
+using Crc32cKernel = uint32_t (*)(uint32_t, const unsigned char*, size_t);
+
+/**
+ * @brief 按运行的 CPU 选择实现（只在第一次调用时检测）
+ */
+static Crc32cKernel SelectKernel() {
+#ifdef RPC_CRC32C_SSE42
+    if (__builtin_cpu_supports("sse4.2")) {
+        return Crc32cHardware;
+    }
+#endif
+    return Crc32cTable;
+}
+
+static Crc32cKernel Kernel() {
+    static const Crc32cKernel kernel = SelectKernel();
+    return kernel;
+}
+
+uint32_t RpcChecksum::Crc32c(const void* data, size_t size, uint32_t crc) {
+    return ~Kernel()(~crc, static_cast<const unsigned char*>(data), size);
+}
+
+uint32_t RpcChecksum::Crc32cPortable(const void* data, size_t size, uint32_t crc) {
+    return ~Crc32cTable(~crc, static_cast<const unsigned char*>(data), size);
+}
+
+bool RpcChecksum::HardwareAccelerated() {
+    return Kernel() != Crc32cTable;
+}
+
+void RpcChecksum::Seal(std::string* frame) {
+    RpcFrame::MarkChecksum(&(*frame)[0]);
+    uint32_t crc = htonl(Crc32c(frame->data(), frame->size()));
+    frame->append(reinterpret_cast<const char*>(&crc), 4);
+}
+
+bool RpcChecksum::Verify(const char* frame, size_t size) {
+    if (size < 8) {
+        return false;
+    }
+    uint32_t expected = 0;
+    memcpy(&expected, frame + size - 4, 4);
+    return Crc32c(frame, size - 4) == ntohl(expected);
+}
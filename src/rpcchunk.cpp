@@ -0,0 +1,102 @@
+#include "rpcchunk.h"
+#include "rpcchecksum.h"
+#include "rpcframe.h"
+#include <arpa/inet.h>
+#include <google/protobuf/io/zero_copy_stream_impl.h>
+#include <memory>
+
+ChunkedFrame::ChunkedFrame(std::string chunk_header, std::string final_header, std::string body, size_t chunk_size)
+    : chunkHeader_(std::move(chunk_header)),
+      finalHeader_(std::move(final_header)),
+      body_(std::move(body)),
+      chunkSize_(chunk_size) {
+}
+
+void ChunkedFrame::EnableChecksum() {
+    checksum_ = true;
+    RpcFrame::MarkChecksum(&chunkHeader_[0]);
+    RpcFrame::MarkChecksum(&finalHeader_[0]);
+    chunkHeaderCrc_ = RpcChecksum::Crc32c(chunkHeader_.data(), chunkHeader_.size());
+    finalHeaderCrc_ = RpcChecksum::Crc32c(finalHeader_.data(), finalHeader_.size());
+}
+
+bool ChunkedFrame::Next(std::vector<boost::asio::const_buffer>* buffers) {
+    size_t remaining = body_.size() - offset_;
+    bool last = remaining <= chunkSize_;
+    size_t size = last ? remaining : chunkSize_;
+    buffers->push_back(boost::asio::buffer(last ? finalHeader_ : chunkHeader_));
+    buffers->push_back(boost::asio::buffer(body_.data() + offset_, size));
+    if (checksum_) {
+        // 数据头的 CRC 已预先算好，每块只需继续计算分块数据
+        uint32_t crc = RpcChecksum::Crc32c(body_.data() + offset_, size, last ? finalHeaderCrc_ : chunkHeaderCrc_);
+        trailer_ = htonl(crc);
+        buffers->push_back(boost::asio::buffer(&trailer_, 4));
+    }
+    offset_ += size;
+    return last;
+}
+
+size_t ChunkedFrame::LastChunkSize(size_t body_size, size_t chunk_size) {
+    return body_size - (body_size - 1) / chunk_size * chunk_size;
+}
+
+void BufferChain::Append(const char* data, size_t size) {
+    if (size == 0) {
+        return;
+    }
+    blocks_.emplace_back(data, size);
+    size_ += size;
+}
+
+bool BufferChain::ParseTo(google::protobuf::Message* message) const {
+    // 每个分块一个输入流，依次串联
+    std::vector<std::unique_ptr<google::protobuf::io::ArrayInputStream>> inputs;
+    std::vector<google::protobuf::io::ZeroCopyInputStream*> streams;
+    inputs.reserve(blocks_.size());
+    streams.reserve(blocks_.size());
+    for (const std::string& block : blocks_) {
+        inputs.emplace_back(new google::protobuf::io::ArrayInputStream(block.data(), block.size()));
+        streams.push_back(inputs.back().get());
+    }
+    google::protobuf::io::ConcatenatingInputStream input(streams.data(), streams.size());
+    return message->ParseFromZeroCopyStream(&input);
+}
+
+void BufferChain::Flatten(std::string* out) const {
+    out->clear();
+    out->reserve(size_);
+    for (const std::string& block : blocks_) {
+        out->append(block);
+    }
+}
+
+void ChunkAssembler::AddChunk(uint64_t request_id, const char* data, size_t size) {
+    Pending& pending = pending_[request_id];
+    if (pending.tooLarge_) {
+        return;
+    }
+    if (pending.chain_.Size() + size > maxMessageSize_) {
+        bytes_ -= pending.chain_.Size();
+        pending.chain_ = BufferChain();
+        pending.tooLarge_ = true;
+        return;
+    }
+    pending.chain_.Append(data, size);
+    bytes_ += size;
+}
+
+ChunkAssembler::Result ChunkAssembler::Finish(uint64_t request_id, const char* data, size_t size, BufferChain* chain) {
+    auto it = pending_.find(request_id);
+    if (it == pending_.end()) {
+        return Result::kSingle;
+    }
+    Pending pending = std::move(it->second);
+    pending_.erase(it);
+    bytes_ -= pending.chain_.Size();
+    if (pending.tooLarge_ || pending.chain_.Size() + size > maxMessageSize_) {
+        return Result::kTooLarge;
+    }
+    pending.chain_.Append(data, size);
+    *chain = std::move(pending.chain_);
+    return Result::kAssembled;
+}
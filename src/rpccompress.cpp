@@ -0,0 +1,323 @@
+#include "rpccompress.h"
+#include "rpcapplication.h"
+#include "rpcmetrics.h"
+#include "rpcheader.pb.h"
+#include <fstream>
+#include <iostream>
+#include <sstream>
+
+#ifdef RPC_HAVE_LZ4
+#include <lz4.h>
+#endif
+#ifdef RPC_HAVE_ZSTD
+#include <zstd.h>
+#include <zdict.h>
+#endif
+#ifdef RPC_HAVE_ZLIB
+#include <zlib.h>
+#endif
+
+/**
+ * @brief 方法的 Zstd 字典
+ */
+struct RpcCompressor::Dictionary {
+    std::string content_;
+    uint32_t id_ = 0;               // 字典id，写在压缩帧中，解压时据此找到字典
+#ifdef RPC_HAVE_ZSTD
+    ZSTD_CDict* cdict_ = nullptr;   // 预处理过的压缩字典
+    ZSTD_DDict* ddict_ = nullptr;   // 预处理过的解压字典
+
+    ~Dictionary() {
+        ZSTD_freeCDict(cdict_);
+        ZSTD_freeDDict(ddict_);
+    }
+#endif
+};
+
+#ifdef RPC_HAVE_ZSTD
+/**
+ * @brief 每个线程复用的 Zstd 压缩/解压上下文
+ */
+struct ZstdContexts {
+    ZSTD_CCtx* cctx_ = ZSTD_createCCtx();
+    ZSTD_DCtx* dctx_ = ZSTD_createDCtx();
+
+    ~ZstdContexts() {
+        ZSTD_freeCCtx(cctx_);
+        ZSTD_freeDCtx(dctx_);
+    }
+};
+
+static ZstdContexts& LocalZstdContexts() {
+    thread_local ZstdContexts contexts;
+    return contexts;
+}
+#endif
+
+/**
+ * @brief 从配置文件加载压缩参数
+ * @return 压缩参数
+ */
+static RpcCompressor::Options LoadCompressorOptions() {
+    RpcConfig& config = RpcApplication::GetConfig();
+
+    RpcCompressor::Options options;
+    options.algorithm = RpcCompressor::ParseAlgorithm(config.Load<std::string>("compression.algorithm", "none"));
+    options.threshold = config.Load<size_t>("compression.threshold", options.threshold);
+    options.level = config.Load<int>("compression.level", options.level);
+    options.dictionary_threshold = config.Load<size_t>("compression.dictionary_threshold", options.dictionary_threshold);
+
+    // 方法名包含 "."，整体读取后再逐个加载字典文件
+    auto files = config.Load<std::map<std::string, std::string>>("compression.dictionaries", {});
+    for (const auto& file : files) {
+        std::ifstream in(file.second, std::ios::binary);
+        if (!in) {
+            std::cerr << "RpcCompressor: open dictionary " << file.second << " failed!" << std::endl;
+            continue;
+        }
+        std::ostringstream content;
+        content << in.rdbuf();
+        options.dictionaries[file.first] = content.str();
+    }
+    return options;
+}
+
+RpcCompressor& RpcCompressor::GetInstance() {
+    static RpcCompressor instance(LoadCompressorOptions());
+    return instance;
+}
+
+RpcCompressor::RpcCompressor(const Options& options)
+    : options_(options) {
+    if (!(SupportedMask() & (1u << options_.algorithm))) {
+        options_.algorithm = rpcheader::COMPRESS_NONE;
+    }
+    for (const auto& entry : options_.dictionaries) {
+#ifdef RPC_HAVE_ZSTD
+        std::unique_ptr<Dictionary> dictionary(new Dictionary);
+        dictionary->content_ = entry.second;
+        dictionary->id_ = ZSTD_getDictID_fromDict(entry.second.data(), entry.second.size());
+        if (dictionary->id_ == 0) {
+            // 没有字典id的原始内容无法在解压时确定字典
+            std::cerr << "RpcCompressor: dictionary of " << entry.first << " is not a trained zstd dictionary" << std::endl;
+            continue;
+        }
+        dictionary->cdict_ = ZSTD_createCDict(dictionary->content_.data(), dictionary->content_.size(), options_.level);
+        dictionary->ddict_ = ZSTD_createDDict(dictionary->content_.data(), dictionary->content_.size());
+        dictionariesById_[dictionary->id_] = dictionary.get();
+        dictionaries_[entry.first] = std::move(dictionary);
+#else
+        std::cerr << "RpcCompressor: zstd is not available, dictionary of " << entry.first << " ignored" << std::endl;
+#endif
+    }
+    options_.dictionaries.clear();  // 字典内容已转存到 dictionaries_
+}
+
+RpcCompressor::~RpcCompressor() = default;
+
+uint32_t RpcCompressor::SupportedMask() {
+    uint32_t mask = 0;
+#ifdef RPC_HAVE_LZ4
+    mask |= 1u << rpcheader::COMPRESS_LZ4;
+#endif
+#ifdef RPC_HAVE_ZSTD
+    mask |= 1u << rpcheader::COMPRESS_ZSTD;
+#endif
+#ifdef RPC_HAVE_ZLIB
+    mask |= 1u << rpcheader::COMPRESS_ZLIB;
+#endif
+    return mask;
+}
+
+int RpcCompressor::ParseAlgorithm(const std::string& name) {
+    if (name == "lz4") {
+        return rpcheader::COMPRESS_LZ4;
+    }
+    if (name == "zstd") {
+        return rpcheader::COMPRESS_ZSTD;
+    }
+    if (name == "zlib") {
+        return rpcheader::COMPRESS_ZLIB;
+    }
+    return rpcheader::COMPRESS_NONE;
+}
+
+void RpcCompressor::RegisterService(const google::protobuf::ServiceDescriptor* service) {
+    if (dictionaries_.empty()) {
+        return;
+    }
+    std::vector<const google::protobuf::MethodDescriptor*> methods;
+    for (int i = 0; i < service->method_count(); ++i) {
+        methods.push_back(service->method(i));
+    }
+    AddMethods(methods);
+}
+
+void RpcCompressor::AddMethods(const std::vector<const google::protobuf::MethodDescriptor*>& methods) const {
+    std::lock_guard<std::mutex> lock(methodsMutex_);
+    const MethodDictionaries* current = methods_.load(std::memory_order_relaxed);
+    std::unique_ptr<MethodDictionaries> next(current ? new MethodDictionaries(*current) : new MethodDictionaries);
+    for (const google::protobuf::MethodDescriptor* method : methods) {
+        auto it = dictionaries_.find(method->service()->name() + "." + method->name());
+        next->emplace(method, it == dictionaries_.end() ? nullptr : it->second.get());
+    }
+    if (current && next->size() == current->size()) {
+        return;     // 其他线程已经登记
+    }
+    methods_.store(next.get(), std::memory_order_release);
+    methodSnapshots_.push_back(std::move(next));
+}
+
+const RpcCompressor::Dictionary* RpcCompressor::FindDictionary(const google::protobuf::MethodDescriptor* method) const {
+    if (dictionaries_.empty() || !method) {
+        return nullptr;
+    }
+    while (true) {
+        const MethodDictionaries* methods = methods_.load(std::memory_order_acquire);
+        if (methods) {
+            auto it = methods->find(method);
+            if (it != methods->end()) {
+                return it->second;
+            }
+        }
+        AddMethods({method});
+    }
+}
+
+int RpcCompressor::Select(const google::protobuf::MethodDescriptor* method, size_t size, uint32_t peer_mask,
+                          const Dictionary** dictionary) const {
+    *dictionary = FindDictionary(method);
+    if (*dictionary && (peer_mask & (1u << rpcheader::COMPRESS_ZSTD))) {
+        return size >= options_.dictionary_threshold ? rpcheader::COMPRESS_ZSTD : rpcheader::COMPRESS_NONE;
+    }
+    *dictionary = nullptr;
+    if (options_.algorithm == rpcheader::COMPRESS_NONE || !(peer_mask & (1u << options_.algorithm))) {
+        return rpcheader::COMPRESS_NONE;
+    }
+    return size >= options_.threshold ? options_.algorithm : rpcheader::COMPRESS_NONE;
+}
+
+bool RpcCompressor::WouldCompress(const google::protobuf::MethodDescriptor* method, size_t size, uint32_t peer_mask) const {
+    const Dictionary* dictionary = nullptr;
+    return Select(method, size, peer_mask, &dictionary) != rpcheader::COMPRESS_NONE;
+}
+
+int RpcCompressor::Compress(const google::protobuf::MethodDescriptor* method, uint32_t peer_mask, std::string* body) const {
+    static std::atomic<int64_t>& messages = RpcMetrics::GetInstance().Counter("compression.messages");
+    static std::atomic<int64_t>& bytes_in = RpcMetrics::GetInstance().Counter("compression.bytes_in");
+    static std::atomic<int64_t>& bytes_out = RpcMetrics::GetInstance().Counter("compression.bytes_out");
+
+    const Dictionary* dictionary = nullptr;
+    int algorithm = Select(method, body->size(), peer_mask, &dictionary);
+    if (algorithm == rpcheader::COMPRESS_NONE) {
+        return rpcheader::COMPRESS_NONE;
+    }
+
+    std::string out;
+    bool ok = false;
+    switch (algorithm) {
+#ifdef RPC_HAVE_LZ4
+        case rpcheader::COMPRESS_LZ4: {
+            out.resize(LZ4_compressBound(body->size()));
+            int size = LZ4_compress_default(body->data(), &out[0], body->size(), out.size());
+            ok = size > 0;
+            out.resize(ok ? size : 0);
+            break;
+        }
+#endif
+#ifdef RPC_HAVE_ZSTD
+        case rpcheader::COMPRESS_ZSTD: {
+            out.resize(ZSTD_compressBound(body->size()));
+            ZstdContexts& contexts = LocalZstdContexts();
+            size_t size = dictionary
+                ? ZSTD_compress_usingCDict(contexts.cctx_, &out[0], out.size(), body->data(), body->size(), dictionary->cdict_)
+                : ZSTD_compressCCtx(contexts.cctx_, &out[0], out.size(), body->data(), body->size(), options_.level);
+            ok = !ZSTD_isError(size);
+            out.resize(ok ? size : 0);
+            break;
+        }
+#endif
+#ifdef RPC_HAVE_ZLIB
+        case rpcheader::COMPRESS_ZLIB: {
+            uLongf size = compressBound(body->size());
+            out.resize(size);
+            ok = compress2((Bytef*)&out[0], &size, (const Bytef*)body->data(), body->size(), options_.level) == Z_OK;
+            out.resize(ok ? size : 0);
+            break;
+        }
+#endif
+        default:
+            break;
+    }
+
+    // 不可压缩的数据（如已压缩的图片）按原样发送
+    if (!ok || out.size() >= body->size()) {
+        return rpcheader::COMPRESS_NONE;
+    }
+    messages.fetch_add(1, std::memory_order_relaxed);
+    bytes_in.fetch_add(body->size(), std::memory_order_relaxed);
+    bytes_out.fetch_add(out.size(), std::memory_order_relaxed);
+    body->swap(out);
+    return algorithm;
+}
+
+bool RpcCompressor::Decompress(int algorithm, const char* data, size_t size, size_t uncompressed_size, std::string* out) const {
+    out->resize(uncompressed_size);
+    switch (algorithm) {
+#ifdef RPC_HAVE_LZ4
+        case rpcheader::COMPRESS_LZ4: {
+            int n = LZ4_decompress_safe(data, &(*out)[0], size, uncompressed_size);
+            return n >= 0 && static_cast<size_t>(n) == uncompressed_size;
+        }
+#endif
+#ifdef RPC_HAVE_ZSTD
+        case rpcheader::COMPRESS_ZSTD: {
+            ZstdContexts& contexts = LocalZstdContexts();
+            size_t n = 0;
+            uint32_t id = ZSTD_getDictID_fromFrame(data, size);
+            if (id != 0) {
+                auto it = dictionariesById_.find(id);
+                if (it == dictionariesById_.end()) {
+                    std::cerr << "RpcCompressor: unknown zstd dictionary " << id << std::endl;
+                    return false;
+                }
+                n = ZSTD_decompress_usingDDict(contexts.dctx_, &(*out)[0], uncompressed_size, data, size, it->second->ddict_);
+            } else {
+                n = ZSTD_decompressDCtx(contexts.dctx_, &(*out)[0], uncompressed_size, data, size);
+            }
+            return !ZSTD_isError(n) && n == uncompressed_size;
+        }
+#endif
+#ifdef RPC_HAVE_ZLIB
+        case rpcheader::COMPRESS_ZLIB: {
+            uLongf n = uncompressed_size;
+            int rc = uncompress((Bytef*)&(*out)[0], &n, (const Bytef*)data, size);
+            return rc == Z_OK && n == uncompressed_size;
+        }
+#endif
+        default:
+            return false;
+    }
+}
+
+bool RpcCompressor::TrainDictionary(const std::vector<std::string>& samples, size_t capacity, std::string* dictionary) {
+#ifdef RPC_HAVE_ZSTD
+    std::string buffer;
+    std::vector<size_t> sizes;
+    sizes.reserve(samples.size());
+    for (const std::string& sample : samples) {
+        buffer.append(sample);
+        sizes.push_back(sample.size());
+    }
+    dictionary->resize(capacity);
+    size_t size = ZDICT_trainFromBuffer(&(*dictionary)[0], capacity, buffer.data(), sizes.data(), sizes.size());
+    if (ZDICT_isError(size)) {
+        dictionary->clear();
+        return false;
+    }
+    dictionary->resize(size);
+    return true;
+#else
+    return false;
+#endif
+}
@@ -0,0 +1,643 @@
+#include "rpcconnection.h"
+#include <algorithm>
+#include "rpcheader.pb.h"
+#include "rpcmetrics.h"
+#include "rpccompress.h"
+#include "rpcchecksum.h"
+#include "rpcframe.h"
+#include "rpchandshake.h"
+#include "rpccontroller.h"
+
+RpcConnection::RpcConnection(const Options& options)
+    : options_(options),
+      work_(boost::asio::make_work_guard(io_context_)),
+      socket_(io_context_),
+      corkTimer_(io_context_),
+      head_(&stub_),
+      tail_(&stub_),
+      buffer_(64 * 1024),
+      chunks_(options.max_message_size) {
+    thread_ = std::thread([this]() { io_context_.run(); });
+}
+
+RpcConnection::~RpcConnection() {
+    // 在IO线程中关闭连接，未完成的调用以失败结束
+    std::promise<void> closed;
+    boost::asio::post(io_context_, [this, &closed]() {
+        Fail("connection closed");
+        closed.set_value();
+    });
+    closed.get_future().wait();
+
+    work_.reset();
+    io_context_.stop();
+    thread_.join();
+
+    // 释放发送队列中剩余的帧
+    while (OutgoingFrame* frame = Pop()) {
+        delete frame;
+    }
+    for (OutgoingFrame* frame : writing_) {
+        delete frame;
+    }
+}
+
+/**
+ * @brief 创建解析单个响应消息的函数
+ * @param response 用于存储响应消息
+ * @return 解析函数
+ */
+static RpcConnection::BodyParser MessageParser(google::protobuf::Message* response) {
+    return [response](const char* body, size_t size) -> std::string {
+        if (!response->ParseFromArray(body, size)) {
+            return "ParseFromString response failed!";
+        }
+        return "";
+    };
+}
+
+void RpcConnection::Call(uint64_t request_id,
+                         std::string frame,
+                         google::protobuf::Message* response,
+                         google::protobuf::RpcController* controller,
+                         google::protobuf::Closure* done,
+                         const google::protobuf::MethodDescriptor* interned,
+                         uint64_t intern_epoch) {
+    OutgoingFrame* node = new OutgoingFrame;
+    node->data_ = std::move(frame);
+    node->interned_ = interned;
+    node->internEpoch_ = intern_epoch;
+    Invoke(request_id, node, PendingCall{MessageParser(response), controller, done, nullptr, nullptr, response});
+}
+
+void RpcConnection::Call(uint64_t request_id,
+                         std::unique_ptr<ChunkedFrame> frame,
+                         google::protobuf::Message* response,
+                         google::protobuf::RpcController* controller,
+                         google::protobuf::Closure* done) {
+    OutgoingFrame* node = new OutgoingFrame;
+    node->chunked_ = std::move(frame);
+    Invoke(request_id, node, PendingCall{MessageParser(response), controller, done, nullptr, nullptr, response});
+}
+
+void RpcConnection::Call(uint64_t request_id,
+                         std::string frame,
+                         BodyParser parser,
+                         google::protobuf::RpcController* controller,
+                         google::protobuf::Closure* done) {
+    OutgoingFrame* node = new OutgoingFrame;
+    node->data_ = std::move(frame);
+    Invoke(request_id, node, PendingCall{std::move(parser), controller, done, nullptr, nullptr});
+}
+
+void RpcConnection::Invoke(uint64_t request_id, OutgoingFrame* frame, PendingCall call) {
+    std::promise<void> waiter;
+    bool sync = call.done_ == nullptr;
+    if (sync) {
+        call.waiter_ = &waiter;
+    }
+    Start(request_id, frame, call);
+    if (sync) {
+        waiter.get_future().wait();
+    }
+}
+
+void RpcConnection::CallStream(uint64_t request_id,
+                               std::string frame,
+                               std::shared_ptr<RpcStream> stream,
+                               google::protobuf::Message* response,
+                               google::protobuf::RpcController* controller,
+                               google::protobuf::Closure* done,
+                               const google::protobuf::MethodDescriptor* interned,
+                               uint64_t intern_epoch) {
+    // 最终的响应帧只有客户端流携带响应消息，其他流式调用的消息体为空
+    BodyParser parser = [response](const char* body, size_t size) -> std::string {
+        if (size > 0 && !response->ParseFromArray(body, size)) {
+            return "ParseFromString response failed!";
+        }
+        return "";
+    };
+    OutgoingFrame* node = new OutgoingFrame;
+    node->data_ = std::move(frame);
+    node->interned_ = interned;
+    node->internEpoch_ = intern_epoch;
+    Start(request_id, node, PendingCall{std::move(parser), controller, done, nullptr, std::move(stream), response});
+}
+
+void RpcConnection::Start(uint64_t request_id, OutgoingFrame* frame, const PendingCall& call) {
+    // 先登记调用再发送，保证响应到达时一定能找到对应的调用
+    {
+        std::lock_guard<std::mutex> lock(pendingMutex_);
+        pending_[request_id] = call;
+    }
+
+    std::string error;
+    if (!EnsureConnected(&error)) {
+        bool found = false;
+        {
+            std::lock_guard<std::mutex> lock(pendingMutex_);
+            found = pending_.erase(request_id) > 0;
+        }
+        delete frame;
+        // 未找到说明调用已经在连接断开时以失败结束
+        if (found) {
+            Complete(call, error);
+        }
+        return;
+    }
+    Enqueue(frame);
+}
+
+bool RpcConnection::Send(std::string frame, std::string* error,
+                         const google::protobuf::MethodDescriptor* interned, uint64_t intern_epoch) {
+    if (!EnsureConnected(error)) {
+        return false;
+    }
+    OutgoingFrame* node = new OutgoingFrame;
+    node->data_ = std::move(frame);
+    node->interned_ = interned;
+    node->internEpoch_ = intern_epoch;
+    Enqueue(node);
+    return true;
+}
+
+uint32_t RpcConnection::InternMethod(const google::protobuf::MethodDescriptor* method, bool* defined, uint64_t* epoch) {
+    std::lock_guard<std::mutex> lock(internMutex_);
+    *epoch = internEpoch_;
+    auto it = interned_.find(method);
+    if (it == interned_.end()) {
+        if (interned_.size() >= RpcFrame::kMaxMethodIndex) {
+            *defined = false;
+            return 0;
+        }
+        uint32_t index = static_cast<uint32_t>(interned_.size()) + 1;
+        it = interned_.insert({method, InternedMethod{index, false}}).first;
+    }
+    *defined = it->second.defined_;
+    return it->second.index_;
+}
+
+void RpcConnection::ConfirmMethod(const google::protobuf::MethodDescriptor* method, uint64_t epoch) {
+    std::lock_guard<std::mutex> lock(internMutex_);
+    if (epoch != internEpoch_) {
+        return;     // 登记帧发往的是重连前的会话
+    }
+    auto it = interned_.find(method);
+    if (it != interned_.end()) {
+        it->second.defined_ = true;
+    }
+}
+
+/**
+ * @brief 把带有连接内序号的 protobuf 数据头改为只带名字（序号所在的会话已经不存在）
+ * @param method 方法描述符
+ * @param frame 请求帧（尚未计算校验和）
+ */
+static void UninternRequest(const google::protobuf::MethodDescriptor* method, std::string* frame) {
+    rpcheader::RpcHeader header;
+    RpcFrame::FrameInfo info;
+    if (RpcFrame::ParseRequestHeader(frame->data(), frame->size(), &header, &info) != RpcFrame::Result::kOk) {
+        return;
+    }
+    header.set_service_name(method->service()->name());
+    header.set_method_name(method->name());
+    header.clear_method_index();
+    std::string rebuilt;
+    RpcFrame::AppendRequestHeader(header, info.fixed, &rebuilt);
+    rebuilt.append(*frame, info.header_bytes, std::string::npos);
+    frame->swap(rebuilt);
+}
+
+void RpcConnection::Enqueue(OutgoingFrame* node) {
+    static std::atomic<int64_t>& stale_interns = RpcMetrics::GetInstance().Counter("client.stale_method_index");
+
+    // 检查登记轮次与入队在同一把锁内完成：连接断开（Fail）和重连都在持锁时增加轮次，
+    // 入队之后轮次才变化的帧对应的调用由 Fail 以失败结束
+    std::unique_lock<std::mutex> intern_lock(internMutex_, std::defer_lock);
+    if (node->interned_) {
+        intern_lock.lock();
+        if (node->internEpoch_ != internEpoch_) {
+            stale_interns.fetch_add(1, std::memory_order_relaxed);
+            UninternRequest(node->interned_, &node->data_);
+        }
+    }
+    // 旧版本的服务端不认识校验和标志，只对在握手中声明了支持的服务端发送校验和
+    if (options_.checksum && peerChecksum_.load(std::memory_order_relaxed)) {
+        if (node->chunked_) {
+            node->chunked_->EnableChecksum();
+        } else {
+            RpcChecksum::Seal(&node->data_);
+        }
+    }
+    Push(node);
+    if (intern_lock.owns_lock()) {
+        intern_lock.unlock();
+    }
+    queuedFrames_.fetch_add(1, std::memory_order_acq_rel);
+    ScheduleWrite();
+}
+
+void RpcConnection::Push(OutgoingFrame* frame) {
+    frame->next_.store(nullptr, std::memory_order_relaxed);
+    OutgoingFrame* prev = head_.exchange(frame, std::memory_order_acq_rel);
+    // 在下面这一步完成前，消费者看不到 frame 及其之后入队的帧
+    prev->next_.store(frame, std::memory_order_release);
+}
+
+RpcConnection::OutgoingFrame* RpcConnection::Pop() {
+    OutgoingFrame* tail = tail_;
+    OutgoingFrame* next = tail->next_.load(std::memory_order_acquire);
+    if (tail == &stub_) {
+        if (next == nullptr) {
+            return nullptr;
+        }
+        tail_ = next;
+        tail = next;
+        next = next->next_.load(std::memory_order_acquire);
+    }
+    if (next != nullptr) {
+        tail_ = next;
+        return tail;
+    }
+    // tail 是队列中最后一个链接完成的帧；若 head_ 已经前移，说明有生产者尚未完成链接
+    if (tail != head_.load(std::memory_order_acquire)) {
+        return nullptr;
+    }
+    // 把 stub_ 放回队尾，才能取出最后一个帧
+    Push(&stub_);
+    next = tail->next_.load(std::memory_order_acquire);
+    if (next != nullptr) {
+        tail_ = next;
+        return tail;
+    }
+    return nullptr;
+}
+
+void RpcConnection::ScheduleWrite() {
+    if (writeScheduled_.exchange(true, std::memory_order_acq_rel)) {
+        return;     // 写者已被唤醒，本次入队的帧会在它结束前被取出
+    }
+    if (options_.cork_us > 0) {
+        boost::asio::post(io_context_, [this]() {
+            corkTimer_.expires_after(std::chrono::microseconds(options_.cork_us));
+            corkTimer_.async_wait([this](const boost::system::error_code&) { DoWrite(); });
+        });
+    } else {
+        boost::asio::post(io_context_, [this]() { DoWrite(); });
+    }
+}
+
+void RpcConnection::DoWrite() {
+    static std::atomic<int64_t>& write_calls = RpcMetrics::GetInstance().Counter("client.write_calls");
+    static std::atomic<int64_t>& write_frames = RpcMetrics::GetInstance().Counter("client.write_frames");
+
+    while (OutgoingFrame* frame = Pop()) {
+        queuedFrames_.fetch_sub(1, std::memory_order_acq_rel);
+        if (frame->chunked_) {
+            // 大请求逐块发送，与其他大请求轮流
+            chunkedFrames_.push_back(std::move(frame->chunked_));
+            delete frame;
+        } else {
+            writing_.push_back(frame);
+        }
+    }
+    if (writing_.empty() && chunkedFrames_.empty()) {
+        FinishWrite();
+        return;
+    }
+    if (!socket_.is_open()) {
+        // 连接已断开：这些帧对应的调用已经以失败结束
+        for (OutgoingFrame* frame : writing_) {
+            delete frame;
+        }
+        writing_.clear();
+        chunkedFrames_.clear();
+        FinishWrite();
+        return;
+    }
+
+    std::vector<boost::asio::const_buffer> buffers;
+    buffers.reserve(writing_.size() + 3);
+    for (OutgoingFrame* frame : writing_) {
+        buffers.push_back(boost::asio::buffer(frame->data_));
+    }
+    // 每次写操作最多附带一个分块，小请求不会排在整个大请求之后
+    bool last_chunk = false;
+    size_t frames = writing_.size();
+    if (!chunkedFrames_.empty()) {
+        chunkedWriting_ = std::move(chunkedFrames_.front());
+        chunkedFrames_.pop_front();
+        last_chunk = chunkedWriting_->Next(&buffers);
+        ++frames;
+    }
+    write_calls.fetch_add(1, std::memory_order_relaxed);
+    write_frames.fetch_add(frames, std::memory_order_relaxed);
+
+    boost::asio::async_write(socket_, buffers,
+        [this, last_chunk](const boost::system::error_code& ec, std::size_t) {
+            for (OutgoingFrame* frame : writing_) {
+                delete frame;
+            }
+            writing_.clear();
+            if (chunkedWriting_ && !last_chunk && !ec && socket_.is_open()) {
+                chunkedFrames_.push_back(std::move(chunkedWriting_));
+            }
+            chunkedWriting_.reset();
+            if (ec) {
+                Fail("send request failed: " + ec.message());
+            }
+            FinishWrite();
+        });
+}
+
+void RpcConnection::FinishWrite() {
+    if (!chunkedFrames_.empty()) {
+        // 还有大请求的分块没有发出：写者保持唤醒状态，不再等待 cork
+        boost::asio::post(io_context_, [this]() { DoWrite(); });
+        return;
+    }
+    writeScheduled_.store(false, std::memory_order_release);
+    // 写者退出前入队的帧可能没有唤醒它（当时 writeScheduled_ 仍为 true），需要再次检查
+    if (queuedFrames_.load(std::memory_order_acquire) > 0) {
+        ScheduleWrite();
+    }
+}
+
+void RpcConnection::DoRead() {
+    static std::atomic<int64_t>& checksum_errors = RpcMetrics::GetInstance().Counter("client.checksum_errors");
+
+    socket_.async_read_some(boost::asio::buffer(buffer_),
+        [this](const boost::system::error_code& ec, std::size_t bytes_transferred) {
+            if (ec) {
+                if (ec != boost::asio::error::operation_aborted) {
+                    Fail("receive response failed: " + ec.message());
+                }
+                return;
+            }
+            received_.append(buffer_.data(), bytes_transferred);
+
+            // 处理所有完整的响应：[数据头（两种格式见 rpcframe.h）][body][4字节校验和（可选）]
+            size_t offset = 0;
+            while (offset < received_.size()) {
+                rpcheader::RpcResponseHeader header;
+                RpcFrame::FrameInfo info;
+                RpcFrame::Result result = RpcFrame::ParseResponseHeader(received_.data() + offset,
+                                                                        received_.size() - offset, &header, &info);
+                if (result == RpcFrame::Result::kIncomplete) {
+                    break;
+                }
+                if (result == RpcFrame::Result::kError) {
+                    Fail("parse response header failed!");
+                    return;
+                }
+                if (header.body_size() > options_.max_message_size) {
+                    // 不等待消息体接收完整就断开，避免为超长的响应缓存数据
+                    Fail("response exceeds max message size");
+                    return;
+                }
+                size_t frame_size = info.header_bytes + header.body_size() + (info.checksum ? 4 : 0);
+                if (received_.size() - offset < frame_size) {
+                    break;
+                }
+                // 校验和不一致说明帧在传输中损坏，之后的帧边界也不再可信
+                if (info.checksum && !RpcChecksum::Verify(received_.data() + offset, frame_size)) {
+                    checksum_errors.fetch_add(1, std::memory_order_relaxed);
+                    Fail("response checksum mismatch");
+                    return;
+                }
+                const char* body = received_.data() + offset + info.header_bytes;
+                offset += frame_size;
+
+                if (header.frame_type() == rpcheader::FRAME_HANDSHAKE) {
+                    if (!OnHandshake(body, header.body_size())) {
+                        Fail("parse handshake failed!");
+                        return;
+                    }
+                    continue;
+                }
+                // 大响应的分块挂到缓冲区链上；最终帧取出已收到的分块（调用已结束时一并丢弃）
+                if (header.frame_type() == rpcheader::FRAME_CHUNK) {
+                    chunks_.AddChunk(header.request_id(), body, header.body_size());
+                    continue;
+                }
+                BufferChain chain;
+                ChunkAssembler::Result assembled = ChunkAssembler::Result::kSingle;
+                if (header.frame_type() == rpcheader::FRAME_UNARY) {
+                    assembled = chunks_.Finish(header.request_id(), body, header.body_size(), &chain);
+                }
+
+                PendingCall call;
+                {
+                    std::lock_guard<std::mutex> lock(pendingMutex_);
+                    auto it = pending_.find(header.request_id());
+                    if (it == pending_.end()) {
+                        continue;   // 调用已经结束（如连接断开后重连），丢弃响应
+                    }
+                    call = it->second;
+                    // 流中的消息和授信不结束调用
+                    if (header.frame_type() == rpcheader::FRAME_UNARY) {
+                        pending_.erase(it);
+                    }
+                }
+
+                if (header.frame_type() == rpcheader::FRAME_STREAM_MESSAGE) {
+                    if (call.stream_ && !call.stream_->OnMessage(std::string(body, header.body_size()))) {
+                        // 服务端超出授信窗口：流已中止（已通知服务端），调用以流量控制错误结束，之后的帧被丢弃
+                        {
+                            std::lock_guard<std::mutex> lock(pendingMutex_);
+                            pending_.erase(header.request_id());
+                        }
+                        Complete(call, "stream flow control window exceeded by server!");
+                    }
+                    continue;
+                }
+                if (header.frame_type() == rpcheader::FRAME_STREAM_CREDIT) {
+                    if (call.stream_) {
+                        call.stream_->OnCredit(header.credit());
+                    }
+                    continue;
+                }
+
+                // 响应元数据交给调用方的 RpcController（其他控制器没有读取元数据的接口，忽略）
+                RpcController* rpc_controller = header.metadata().empty() ? nullptr
+                                                : dynamic_cast<RpcController*>(call.controller_);
+                if (rpc_controller && !rpc_controller->SetIncomingMetadata(std::move(*header.mutable_metadata()))) {
+                    Complete(call, "parse response metadata failed!");
+                    continue;
+                }
+
+                // 服务端返回错误状态（如过载被拒绝），此时没有响应消息体
+                if (header.status() != rpcheader::RPC_OK) {
+                    Complete(call, header.error_text());
+                } else if (assembled == ChunkAssembler::Result::kTooLarge) {
+                    Complete(call, "response exceeds max message size");
+                } else {
+                    Complete(call, ParseResponse(call, header.compression(), header.uncompressed_size(), body,
+                                                 header.body_size(),
+                                                 assembled == ChunkAssembler::Result::kAssembled ? &chain : nullptr));
+                }
+            }
+            received_.erase(0, offset);
+            DoRead();
+        });
+}
+
+bool RpcConnection::EnsureConnected(std::string* error) {
+    if (connected_.load(std::memory_order_acquire)) {
+        return true;
+    }
+    std::lock_guard<std::mutex> lock(connectMutex_);
+    if (connected_.load(std::memory_order_acquire)) {
+        return true;
+    }
+
+    // 套接字只在IO线程中操作
+    std::promise<std::string> result;
+    boost::asio::post(io_context_, [this, &result]() {
+        boost::system::error_code ec;
+        if (socket_.is_open()) {
+            socket_.close(ec);
+        }
+        received_.clear();
+        chunks_.Clear();
+        peerCompression_.store(0, std::memory_order_relaxed);
+        peerFrameVersion_.store(0, std::memory_order_relaxed);
+        peerMaxMessageSize_.store(0, std::memory_order_relaxed);
+        peerChecksum_.store(false, std::memory_order_relaxed);
+        peerAmbiguous_.store(false, std::memory_order_relaxed);
+        {
+            // 新连接上的服务端会话没有登记过任何序号
+            std::lock_guard<std::mutex> lock(internMutex_);
+            interned_.clear();
+            ++internEpoch_;
+        }
+        boost::asio::ip::tcp::resolver resolver(io_context_);
+        auto endpoints = resolver.resolve(options_.ip, std::to_string(options_.port), ec);
+        if (!ec) {
+            boost::asio::connect(socket_, endpoints, ec);
+        }
+        if (ec) {
+            boost::system::error_code close_ec;
+            socket_.close(close_ec);
+            result.set_value("RPC call exception: " + ec.message());
+            return;
+        }
+        socket_.set_option(boost::asio::ip::tcp::no_delay(true), ec);
+        // 握手帧先于之后的请求入队；不等待回复，回复到达之前的请求使用基本协议
+        OutgoingFrame* handshake = new OutgoingFrame;
+        handshake->data_ = RpcHandshake::BuildRequest(RpcHandshake::Local(options_.max_message_size));
+        Enqueue(handshake);
+        connected_.store(true, std::memory_order_release);
+        DoRead();
+        result.set_value("");
+    });
+
+    *error = result.get_future().get();
+    return error->empty();
+}
+
+bool RpcConnection::OnHandshake(const char* body, size_t size) {
+    static std::atomic<int64_t>& handshakes = RpcMetrics::GetInstance().Counter("client.handshakes");
+
+    RpcHandshake::Capabilities peer;
+    if (!RpcHandshake::Parse(body, size, &peer)) {
+        return false;
+    }
+    handshakes.fetch_add(1, std::memory_order_relaxed);
+    peerCompression_.store(peer.compression, std::memory_order_relaxed);
+    peerFrameVersion_.store(peer.version, std::memory_order_relaxed);
+    peerMaxMessageSize_.store(peer.max_message_size, std::memory_order_relaxed);
+    peerChecksum_.store(peer.checksum, std::memory_order_relaxed);
+    {
+        std::lock_guard<std::mutex> lock(ambiguousMutex_);
+        peerAmbiguousIds_ = peer.ambiguous_method_ids;
+    }
+    peerAmbiguous_.store(!peer.ambiguous_method_ids.empty(), std::memory_order_release);
+    return true;
+}
+
+bool RpcConnection::PeerAmbiguousMethod(const google::protobuf::MethodDescriptor* method) const {
+    if (!peerAmbiguous_.load(std::memory_order_acquire)) {
+        return false;
+    }
+    uint32_t method_id = RpcFrame::MethodId(method);
+    std::lock_guard<std::mutex> lock(ambiguousMutex_);
+    return std::binary_search(peerAmbiguousIds_.begin(), peerAmbiguousIds_.end(), method_id);
+}
+
+void RpcConnection::Fail(const std::string& reason) {
+    connected_.store(false, std::memory_order_release);
+    boost::system::error_code ec;
+    socket_.close(ec);
+    corkTimer_.cancel();
+    chunks_.Clear();
+    chunkedFrames_.clear();     // 正在发送的分块由写操作完成时释放
+    // 断开后服务端会话及其登记的序号都已不存在：在重连之前发起的调用使用基本协议、只带名字
+    peerCompression_.store(0, std::memory_order_relaxed);
+    peerFrameVersion_.store(0, std::memory_order_relaxed);
+    peerMaxMessageSize_.store(0, std::memory_order_relaxed);
+    peerChecksum_.store(false, std::memory_order_relaxed);
+    peerAmbiguous_.store(false, std::memory_order_relaxed);
+    {
+        std::lock_guard<std::mutex> lock(internMutex_);
+        interned_.clear();
+        ++internEpoch_;
+    }
+
+    std::unordered_map<uint64_t, PendingCall> calls;
+    {
+        std::lock_guard<std::mutex> lock(pendingMutex_);
+        calls.swap(pending_);
+    }
+    for (const auto& call : calls) {
+        Complete(call.second, reason);
+    }
+}
+
+std::string RpcConnection::ParseResponse(const PendingCall& call, int compression, size_t uncompressed_size,
+                                         const char* body, size_t size, const BufferChain* chain) const {
+    std::string flat;
+    if (compression != rpcheader::COMPRESS_NONE) {
+        // 压缩的消息体需要连续内存，解压后的长度同样受最大消息长度限制
+        if (uncompressed_size > options_.max_message_size) {
+            return "response exceeds max message size";
+        }
+        if (chain) {
+            chain->Flatten(&flat);
+            body = flat.data();
+            size = flat.size();
+        }
+        std::string plain;
+        if (!RpcCompressor::GetInstance().Decompress(compression, body, size, uncompressed_size, &plain)) {
+            return "decompress response failed!";
+        }
+        return call.parser_(plain.data(), plain.size());
+    }
+    if (!chain) {
+        return call.parser_(body, size);
+    }
+    if (call.response_) {
+        if (!chain->ParseTo(call.response_)) {
+            return "ParseFromString response failed!";
+        }
+        return "";
+    }
+    chain->Flatten(&flat);
+    return call.parser_(flat.data(), flat.size());
+}
+
+void RpcConnection::Complete(const PendingCall& call, const std::string& error) {
+    if (!error.empty() && call.controller_) {
+        call.controller_->SetFailed(error);
+    }
+    // 流式调用：先报告错误再关闭流，Read 返回 false（或 Wait 返回）后即可通过 controller 判断结果；
+    // 关闭前已收到的消息仍可读取，调用结束后 Write 立即返回 false
+    if (call.stream_) {
+        call.stream_->Close();
+    }
+    if (call.done_) {
+        call.done_->Run();
+    } else if (call.waiter_) {
+        call.waiter_->set_value();
+    }
+}
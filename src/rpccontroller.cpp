@@ -7,6 +7,9 @@ RpcController::RpcController() :
 void RpcController::Reset() {
     failed_ = false;
     errText_.clear();
+    stream_.reset();
+    metadataIn_.clear();
+    metadataEntries_.clear();
 }
 
 bool RpcController::Failed() const {
@@ -32,4 +35,108 @@ bool RpcController::IsCanceled() const {
 
 void RpcController::NotifyOnCancel(google::protobuf::Closure *callback) {
     // 尚未实现
+}
+
+void RpcController::SetTenant(const std::string& tenant) {
+    tenant_ = tenant;
+}
+
+const std::string& RpcController::GetTenant() const {
+    return tenant_;
+}
+
+void RpcController::SetTimeout(uint32_t timeout_ms) {
+    timeoutMs_ = timeout_ms;
+}
+
+uint32_t RpcController::GetTimeout() const {
+    return timeoutMs_;
+}
+
+/**
+ * @brief 追加一个 varint 编码的长度
+ */
+static void AppendVarint(std::string* out, size_t value) {
+    while (value >= 0x80) {
+        out->push_back(static_cast<char>((value & 0x7F) | 0x80));
+        value >>= 7;
+    }
+    out->push_back(static_cast<char>(value));
+}
+
+/**
+ * @brief 读取一个 varint 编码的长度
+ * @return 格式错误或超出数据末尾时返回 false
+ */
+static bool ReadVarint(const char** p, const char* end, size_t* value) {
+    *value = 0;
+    for (int shift = 0; shift < 35 && *p < end; shift += 7) {
+        unsigned char byte = static_cast<unsigned char>(*(*p)++);
+        *value |= static_cast<size_t>(byte & 0x7F) << shift;
+        if ((byte & 0x80) == 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void RpcController::SetMetadata(const std::string& key, const std::string& value) {
+    AppendVarint(&metadataOut_, key.size());
+    metadataOut_.append(key);
+    AppendVarint(&metadataOut_, value.size());
+    metadataOut_.append(value);
+}
+
+void RpcController::ClearMetadata() {
+    metadataOut_.clear();
+}
+
+std::string_view RpcController::GetMetadata(std::string_view key) const {
+    // 元数据通常只有几项，顺序查找比建立索引更快
+    for (const MetadataEntry& entry : metadataEntries_) {
+        if (entry.first == key) {
+            return entry.second;
+        }
+    }
+    return std::string_view();
+}
+
+const std::vector<RpcController::MetadataEntry>& RpcController::GetAllMetadata() const {
+    return metadataEntries_;
+}
+
+const std::string& RpcController::OutgoingMetadata() const {
+    return metadataOut_;
+}
+
+bool RpcController::SetIncomingMetadata(std::string block) {
+    metadataIn_ = std::move(block);
+    metadataEntries_.clear();
+    const char* p = metadataIn_.data();
+    const char* end = p + metadataIn_.size();
+    while (p < end) {
+        size_t key_size = 0;
+        if (!ReadVarint(&p, end, &key_size) || key_size > static_cast<size_t>(end - p)) {
+            metadataEntries_.clear();
+            return false;
+        }
+        std::string_view key(p, key_size);
+        p += key_size;
+        size_t value_size = 0;
+        if (!ReadVarint(&p, end, &value_size) || value_size > static_cast<size_t>(end - p)) {
+            metadataEntries_.clear();
+            return false;
+        }
+        metadataEntries_.emplace_back(key, std::string_view(p, value_size));
+        p += value_size;
+    }
+    return true;
+}
+
+RpcStream* RpcController::GetStream() const {
+    return stream_.get();
+}
+
+void RpcController::SetStream(std::shared_ptr<RpcStream> stream) {
+    stream_ = std::move(stream);
 }
\ No newline at end of file
@@ -0,0 +1,261 @@
+#include "rpcexecutor.h"
+#include <algorithm>
+#include <iostream>
+
+CodelDetector::CodelDetector(std::chrono::steady_clock::duration target, std::chrono::steady_clock::duration interval) :
+    target_(target),
+    interval_(interval),
+    interval_end_(std::chrono::steady_clock::now() + interval),
+    min_sojourn_(std::chrono::steady_clock::duration::max()) {}
+
+bool CodelDetector::ShouldDrop(std::chrono::steady_clock::duration sojourn, std::chrono::steady_clock::time_point now) {
+    if (now >= interval_end_) {
+        // 窗口结束：整个窗口内最小排队时间仍高于 target，说明队列持续积压
+        overloaded_ = min_sojourn_ > target_;
+        min_sojourn_ = sojourn;
+        interval_end_ = now + interval_;
+    } else if (sojourn < min_sojourn_) {
+        min_sojourn_ = sojourn;
+    }
+
+    return overloaded_ && sojourn > 2 * target_;
+}
+
+RpcExecutor::Flow::Flow(const std::string& key, double weight, const Options& options) :
+    key_(key),
+    weight_(weight),
+    codel_(std::chrono::milliseconds(options.codel_target_ms), std::chrono::milliseconds(options.codel_interval_ms)) {}
+
+RpcExecutor::RpcExecutor(const Options& options) :
+    options_(options),
+    flowIdle_(std::max<std::chrono::steady_clock::duration>(
+        std::chrono::milliseconds(options.codel_interval_ms) * kFlowIdleIntervals, std::chrono::seconds(1))),
+    nextReap_(std::chrono::steady_clock::now() + flowIdle_) {
+    queues_[current_].deficit_ = options_.priority_weights[current_];
+    for (int i = 0; i < options_.threads; ++i) {
+        workers_.emplace_back([this]() { WorkerLoop(); });
+    }
+}
+
+RpcExecutor::~RpcExecutor() {
+    Stop();
+}
+
+void RpcExecutor::Submit(Priority priority, const std::string& flow, std::function<void()> run, std::function<void()> shed) {
+    // 关闭公平调度时所有任务都属于同一个流
+    const std::string& key = options_.fair_queue_enable ? flow : std::string();
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        if (stopped_) {
+            // 已停止：不再执行，按过载丢弃
+            lock.unlock();
+            shed();
+            return;
+        }
+        auto now = std::chrono::steady_clock::now();
+        if (now >= nextReap_) {
+            ReapIdleFlows(now);
+        }
+        PriorityQueue& queue = queues_[static_cast<int>(priority)];
+        auto it = queue.flows_.find(key);
+        if (it == queue.flows_.end()) {
+            auto wit = options_.flow_weights.find(key);
+            double weight = wit == options_.flow_weights.end() || wit->second <= 0 ? 1.0 : wit->second;
+            it = queue.flows_.emplace(key, std::unique_ptr<Flow>(new Flow(key, weight, options_))).first;
+        }
+        Flow* entry = it->second.get();
+        if (!entry->active_) {
+            // 新出现或重新有任务的流加入轮转队列队尾，轮到它时再获得额度
+            entry->active_ = true;
+            queue.activeFlows_.push_back(entry);
+        }
+        entry->queue_.push_back(Task{std::move(run), std::move(shed), now});
+        ++queue.queued_;
+        ++queued_;
+    }
+    cond_.notify_one();
+}
+
+void RpcExecutor::Stop() {
+    std::vector<Task> shed_tasks;   // 尚未执行的任务
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (stopped_) {
+            return;
+        }
+        stopped_ = true;
+        for (PriorityQueue& queue : queues_) {
+            for (auto& entry : queue.flows_) {
+                for (Task& task : entry.second->queue_) {
+                    shed_tasks.push_back(std::move(task));
+                }
+            }
+            queue.activeFlows_.clear();
+            queue.flows_.clear();
+            queue.queued_ = 0;
+        }
+        queued_ = 0;
+    }
+    cond_.notify_all();
+
+    for (auto& worker : workers_) {
+        worker.join();
+    }
+    workers_.clear();
+
+    // 未执行的任务按过载丢弃：由 shed 回调回复调用方并释放任务持有的资源
+    for (auto& shed_task : shed_tasks) {
+        shed_task.shed_();
+    }
+}
+
+size_t RpcExecutor::GetQueueSize() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return queued_;
+}
+
+RpcExecutor::ShedMode RpcExecutor::ParseShedMode(const std::string& name) {
+    if (name == "lifo") {
+        return ShedMode::Lifo;
+    }
+    if (name != "drop_oldest") {
+        std::cerr << "RpcExecutor: unknown shed mode " << name << ", use drop_oldest" << std::endl;
+    }
+    return ShedMode::DropOldest;
+}
+
+RpcExecutor::Priority RpcExecutor::ParsePriority(const std::string& name) {
+    if (name == "critical") {
+        return Priority::Critical;
+    }
+    if (name == "batch") {
+        return Priority::Batch;
+    }
+    if (name != "normal") {
+        std::cerr << "RpcExecutor: unknown priority " << name << ", use normal" << std::endl;
+    }
+    return Priority::Normal;
+}
+
+bool RpcExecutor::PickTask(Task* task, std::vector<Task>* shed_tasks) {
+    if (options_.priority_strict) {
+        // 严格优先：总是从优先级最高的非空队列中取任务
+        for (PriorityQueue& queue : queues_) {
+            if (PickFromQueue(queue, task, shed_tasks)) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // 加权轮转：每轮每个优先级获得 priority_weights 个任务的额度，高优先级不会饿死低优先级
+    while (queued_ > 0) {
+        PriorityQueue& queue = queues_[current_];
+        if (queue.queued_ > 0 && queue.deficit_ >= 1) {
+            if (PickFromQueue(queue, task, shed_tasks)) {
+                queue.deficit_ -= 1;
+                return true;
+            }
+            continue;   // 该优先级的任务全部因过载被丢弃
+        }
+
+        // 额度用完或队列为空：轮到下一个优先级并为其补充额度，空队列不积累额度
+        if (queue.queued_ == 0) {
+            queue.deficit_ = 0;
+        }
+        current_ = (current_ + 1) % kPriorityCount;
+        queues_[current_].deficit_ += options_.priority_weights[current_];
+    }
+    return false;
+}
+
+bool RpcExecutor::PickFromQueue(PriorityQueue& queue, Task* task, std::vector<Task>* shed_tasks) {
+    std::deque<Flow*>& activeFlows = queue.activeFlows_;
+    while (!activeFlows.empty()) {
+        Flow* flow = activeFlows.front();
+
+        // 本轮额度不足一个任务：补充额度，轮到下一个流
+        if (flow->deficit_ < 1) {
+            flow->deficit_ += flow->weight_;
+            activeFlows.pop_front();
+            activeFlows.push_back(flow);
+            continue;
+        }
+
+        if (options_.codel_enable) {
+            // 只用队首（最老）任务的排队时间做检测：队列一旦被排空，队首的排队时间就会降到 target 以下
+            auto now = std::chrono::steady_clock::now();
+            while (!flow->queue_.empty() && flow->codel_.ShouldDrop(now - flow->queue_.front().enqueue_, now)) {
+                shed_tasks->push_back(std::move(flow->queue_.front()));
+                flow->queue_.pop_front();
+                --queue.queued_;
+                --queued_;
+            }
+        }
+
+        bool picked = false;
+        if (!flow->queue_.empty()) {
+            if (options_.shed_mode == ShedMode::Lifo && flow->codel_.IsOverloaded()) {
+                *task = std::move(flow->queue_.back());
+                flow->queue_.pop_back();
+            } else {
+                *task = std::move(flow->queue_.front());
+                flow->queue_.pop_front();
+            }
+            flow->deficit_ -= 1;
+            --queue.queued_;
+            --queued_;
+            picked = true;
+        }
+
+        // 流已排空：移出轮转队列，剩余额度不保留；流及其 CoDel 状态保留到空闲超时
+        if (flow->queue_.empty()) {
+            activeFlows.pop_front();
+            flow->active_ = false;
+            flow->deficit_ = 0;
+            flow->idleSince_ = std::chrono::steady_clock::now();
+        }
+
+        if (picked) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void RpcExecutor::ReapIdleFlows(std::chrono::steady_clock::time_point now) {
+    // 每 flowIdle_ 检查一次，流的数量只随最近活跃的连接/租户增长
+    for (PriorityQueue& queue : queues_) {
+        for (auto it = queue.flows_.begin(); it != queue.flows_.end();) {
+            if (!it->second->active_ && now - it->second->idleSince_ >= flowIdle_) {
+                it = queue.flows_.erase(it);
+            } else {
+                ++it;
+            }
+        }
+    }
+    nextReap_ = now + flowIdle_;
+}
+
+void RpcExecutor::WorkerLoop() {
+    while (true) {
+        std::vector<Task> shed_tasks;   // 本轮因过载被丢弃的任务
+        Task task;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            cond_.wait(lock, [this]() { return stopped_ || queued_ > 0; });
+            if (stopped_) {
+                return;
+            }
+            PickTask(&task, &shed_tasks);
+        }
+
+        // 在锁外执行回调
+        for (auto& shed_task : shed_tasks) {
+            shed_task.shed_();
+        }
+        if (task.run_) {
+            task.run_();
+        }
+    }
+}
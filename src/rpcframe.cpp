@@ -0,0 +1,244 @@
+#include "rpcframe.h"
+#include <arpa/inet.h>
+#include <endian.h>
+#include <cstring>
+#include "rpcchecksum.h"
+
+static const unsigned char kFixedFirstByte = RpcFrame::kMagic >> 8;    // 定长数据头的第一个字节（protobuf 数据头的第一个字节只能是 0x00/0x80）
+
+static void Store16(char* p, uint16_t value) {
+    value = htons(value);
+    memcpy(p, &value, 2);
+}
+
+static void Store32(char* p, uint32_t value) {
+    value = htonl(value);
+    memcpy(p, &value, 4);
+}
+
+static void Store64(char* p, uint64_t value) {
+    value = htobe64(value);
+    memcpy(p, &value, 8);
+}
+
+static uint16_t Load16(const char* p) {
+    uint16_t value;
+    memcpy(&value, p, 2);
+    return ntohs(value);
+}
+
+static uint32_t Load32(const char* p) {
+    uint32_t value;
+    memcpy(&value, p, 4);
+    return ntohl(value);
+}
+
+static uint64_t Load64(const char* p) {
+    uint64_t value;
+    memcpy(&value, p, 8);
+    return be64toh(value);
+}
+
+/**
+ * @brief 写入定长数据头，返回 frame 中定长数据头的起始位置（ext_size 由调用方回填）
+ */
+static size_t AppendFixed(std::string* frame, int frame_type, uint16_t flags, uint16_t status, uint64_t request_id,
+                          uint32_t method_id, uint32_t timeout_ms, uint32_t body_size) {
+    size_t offset = frame->size();
+    frame->resize(offset + RpcFrame::kFixedHeaderSize);
+    char* p = &(*frame)[offset];
+    Store16(p, RpcFrame::kMagic);
+    p[2] = static_cast<char>(RpcFrame::kVersion);
+    p[3] = static_cast<char>(frame_type);
+    Store16(p + 4, flags);
+    Store16(p + 6, status);
+    Store64(p + 8, request_id);
+    Store32(p + 16, method_id);
+    Store32(p + 20, timeout_ms);
+    Store32(p + 24, body_size);
+    Store32(p + 28, 0);
+    return offset;
+}
+
+/**
+ * @brief 追加扩展数据头并回填 ext_size
+ */
+template <typename Header>
+static void AppendExt(const Header& ext, size_t offset, std::string* frame) {
+    uint32_t ext_size = static_cast<uint32_t>(ext.ByteSizeLong());
+    if (ext_size == 0) {
+        return;
+    }
+    Store32(&(*frame)[offset + 28], ext_size);
+    size_t pos = frame->size();
+    frame->resize(pos + ext_size);
+    ext.SerializeToArray(&(*frame)[pos], static_cast<int>(ext_size));
+}
+
+/**
+ * @brief 追加 protobuf 数据头：4字节 header_size + 数据头
+ */
+template <typename Header>
+static void AppendLegacy(const Header& header, std::string* frame) {
+    uint32_t header_size = static_cast<uint32_t>(header.ByteSizeLong());
+    size_t pos = frame->size();
+    frame->resize(pos + 4 + header_size);
+    Store32(&(*frame)[pos], header_size);
+    header.SerializeToArray(&(*frame)[pos + 4], static_cast<int>(header_size));
+}
+
+/**
+ * @brief 解码 protobuf 数据头
+ */
+template <typename Header>
+static RpcFrame::Result ParseLegacy(const char* data, size_t size, Header* header, RpcFrame::FrameInfo* info) {
+    if (size < 4) {
+        return RpcFrame::Result::kIncomplete;
+    }
+    uint32_t header_size = Load32(data);
+    info->fixed = false;
+    info->checksum = (header_size & RpcChecksum::kFrameFlag) != 0;
+    header_size &= ~RpcChecksum::kFrameFlag;
+    if (header_size > RpcFrame::kMaxHeaderSize) {
+        return RpcFrame::Result::kError;
+    }
+    if (size < 4 + static_cast<size_t>(header_size)) {
+        return RpcFrame::Result::kIncomplete;
+    }
+    if (!header->ParseFromArray(data + 4, static_cast<int>(header_size))) {
+        return RpcFrame::Result::kError;
+    }
+    info->header_bytes = 4 + header_size;
+    return RpcFrame::Result::kOk;
+}
+
+/**
+ * @brief 校验定长数据头并解码扩展数据头（定长字段由调用方填入）
+ */
+template <typename Header>
+static RpcFrame::Result ParseFixed(const char* data, size_t size, Header* header, RpcFrame::FrameInfo* info) {
+    if (size < RpcFrame::kFixedHeaderSize) {
+        return RpcFrame::Result::kIncomplete;
+    }
+    if (Load16(data) != RpcFrame::kMagic || static_cast<uint8_t>(data[2]) != RpcFrame::kVersion) {
+        return RpcFrame::Result::kError;
+    }
+    uint32_t ext_size = Load32(data + 28);
+    if (ext_size > RpcFrame::kMaxHeaderSize) {
+        return RpcFrame::Result::kError;
+    }
+    if (size < RpcFrame::kFixedHeaderSize + ext_size) {
+        return RpcFrame::Result::kIncomplete;
+    }
+    if (ext_size == 0) {
+        header->Clear();
+    } else if (!header->ParseFromArray(data + RpcFrame::kFixedHeaderSize, static_cast<int>(ext_size))) {
+        return RpcFrame::Result::kError;
+    }
+    info->fixed = true;
+    info->checksum = (Load16(data + 4) & RpcFrame::kFlagChecksum) != 0;
+    info->header_bytes = RpcFrame::kFixedHeaderSize + ext_size;
+    return RpcFrame::Result::kOk;
+}
+
+uint32_t RpcFrame::MethodId(const google::protobuf::MethodDescriptor* method) {
+    const std::string& name = method->full_name();
+    return RpcChecksum::Crc32c(name.data(), name.size());
+}
+
+void RpcFrame::AppendRequestHeader(const rpcheader::RpcHeader& header, bool fixed, std::string* frame) {
+    if (!fixed) {
+        AppendLegacy(header, frame);
+        return;
+    }
+    uint16_t flags = static_cast<uint16_t>(header.compression() << kCompressionShift) & kCompressionMask;
+    if (header.one_way()) {
+        flags |= kFlagOneWay;
+    }
+    size_t offset = AppendFixed(frame, header.frame_type(), flags, 0, header.request_id(), header.method_id(),
+                                header.timeout_ms(), header.args_size());
+    if (header.tenant().empty() && header.batch_count() == 0 && header.credit() == 0 &&
+        header.uncompressed_size() == 0 && header.metadata().empty()) {
+        return;     // 常见的请求没有扩展数据头
+    }
+    rpcheader::RpcHeader ext;
+    ext.set_tenant(header.tenant());
+    ext.set_batch_count(header.batch_count());
+    ext.set_credit(header.credit());
+    ext.set_uncompressed_size(header.uncompressed_size());
+    ext.set_metadata(header.metadata());
+    AppendExt(ext, offset, frame);
+}
+
+void RpcFrame::AppendResponseHeader(const rpcheader::RpcResponseHeader& header, bool fixed, std::string* frame) {
+    if (!fixed) {
+        AppendLegacy(header, frame);
+        return;
+    }
+    uint16_t flags = static_cast<uint16_t>(header.compression() << kCompressionShift) & kCompressionMask;
+    size_t offset = AppendFixed(frame, header.frame_type(), flags, static_cast<uint16_t>(header.status()),
+                                header.request_id(), 0, 0, header.body_size());
+    if (header.error_text().empty() && header.batch_count() == 0 && header.credit() == 0 &&
+        header.uncompressed_size() == 0 && header.metadata().empty()) {
+        return;
+    }
+    rpcheader::RpcResponseHeader ext;
+    ext.set_error_text(header.error_text());
+    ext.set_batch_count(header.batch_count());
+    ext.set_credit(header.credit());
+    ext.set_uncompressed_size(header.uncompressed_size());
+    ext.set_metadata(header.metadata());
+    AppendExt(ext, offset, frame);
+}
+
+RpcFrame::Result RpcFrame::ParseRequestHeader(const char* data, size_t size, rpcheader::RpcHeader* header,
+                                              FrameInfo* info) {
+    if (size == 0) {
+        return Result::kIncomplete;
+    }
+    if (static_cast<unsigned char>(data[0]) != kFixedFirstByte) {
+        return ParseLegacy(data, size, header, info);
+    }
+    Result result = ParseFixed(data, size, header, info);
+    if (result != Result::kOk) {
+        return result;
+    }
+    uint16_t flags = Load16(data + 4);
+    header->set_frame_type(static_cast<rpcheader::FrameType>(static_cast<uint8_t>(data[3])));
+    header->set_one_way((flags & kFlagOneWay) != 0);
+    header->set_compression(static_cast<rpcheader::CompressionType>((flags & kCompressionMask) >> kCompressionShift));
+    header->set_request_id(Load64(data + 8));
+    header->set_method_id(Load32(data + 16));
+    header->set_timeout_ms(Load32(data + 20));
+    header->set_args_size(Load32(data + 24));
+    return Result::kOk;
+}
+
+RpcFrame::Result RpcFrame::ParseResponseHeader(const char* data, size_t size, rpcheader::RpcResponseHeader* header,
+                                               FrameInfo* info) {
+    if (size == 0) {
+        return Result::kIncomplete;
+    }
+    if (static_cast<unsigned char>(data[0]) != kFixedFirstByte) {
+        return ParseLegacy(data, size, header, info);
+    }
+    Result result = ParseFixed(data, size, header, info);
+    if (result != Result::kOk) {
+        return result;
+    }
+    uint16_t flags = Load16(data + 4);
+    header->set_frame_type(static_cast<rpcheader::FrameType>(static_cast<uint8_t>(data[3])));
+    header->set_compression(static_cast<rpcheader::CompressionType>((flags & kCompressionMask) >> kCompressionShift));
+    header->set_status(static_cast<rpcheader::RpcStatus>(Load16(data + 6)));
+    header->set_request_id(Load64(data + 8));
+    header->set_body_size(Load32(data + 24));
+    return Result::kOk;
+}
+
+void RpcFrame::MarkChecksum(char* frame) {
+    if (static_cast<unsigned char>(frame[0]) == kFixedFirstByte) {
+        frame[5] = static_cast<char>(frame[5] | kFlagChecksum);     // flags 的低字节
+    } else {
+        frame[0] = static_cast<char>(frame[0] | 0x80);  // header_size 为网络字节序，最高位在第一个字节
+    }
+}
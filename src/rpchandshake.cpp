@@ -0,0 +1,75 @@
+#include "rpchandshake.h"
+#include <algorithm>
+#include "rpcheader.pb.h"
+#include "rpccompress.h"
+#include "rpcframe.h"
+
+RpcHandshake::Capabilities RpcHandshake::Local(size_t max_message_size) {
+    Capabilities capabilities;
+    capabilities.version = RpcFrame::kVersion;
+    capabilities.compression = RpcCompressor::SupportedMask();
+    capabilities.max_message_size = max_message_size;
+    capabilities.multiplexing = true;
+    capabilities.checksum = true;   // 收到带校验和的帧时总是校验，与本端是否发送校验和无关
+    return capabilities;
+}
+
+/**
+ * @brief 把能力序列化为握手帧的消息体
+ * @param capabilities 能力
+ * @return 消息体
+ */
+static std::string SerializeCapabilities(const RpcHandshake::Capabilities& capabilities) {
+    rpcheader::Handshake handshake;
+    handshake.set_protocol_version(capabilities.version);
+    handshake.set_compression(capabilities.compression);
+    handshake.set_max_message_size(capabilities.max_message_size);
+    handshake.set_multiplexing(capabilities.multiplexing);
+    handshake.set_checksum(capabilities.checksum);
+    for (uint32_t method_id : capabilities.ambiguous_method_ids) {
+        handshake.add_ambiguous_method_ids(method_id);
+    }
+    return handshake.SerializeAsString();
+}
+
+std::string RpcHandshake::BuildRequest(const Capabilities& capabilities) {
+    std::string body = SerializeCapabilities(capabilities);
+    rpcheader::RpcHeader header;
+    header.set_frame_type(rpcheader::FRAME_HANDSHAKE);
+    header.set_args_size(body.size());
+
+    // 握手之前不知道对端是否支持定长数据头，只能使用 protobuf 数据头
+    std::string frame;
+    RpcFrame::AppendRequestHeader(header, false, &frame);
+    frame.append(body);
+    return frame;
+}
+
+std::string RpcHandshake::BuildResponse(const Capabilities& capabilities) {
+    std::string body = SerializeCapabilities(capabilities);
+    rpcheader::RpcResponseHeader header;
+    header.set_status(rpcheader::RPC_OK);
+    header.set_frame_type(rpcheader::FRAME_HANDSHAKE);
+    header.set_body_size(body.size());
+
+    std::string frame;
+    RpcFrame::AppendResponseHeader(header, false, &frame);
+    frame.append(body);
+    return frame;
+}
+
+bool RpcHandshake::Parse(const char* body, size_t size, Capabilities* capabilities) {
+    rpcheader::Handshake handshake;
+    if (!handshake.ParseFromArray(body, size)) {
+        return false;
+    }
+    capabilities->version = handshake.protocol_version();
+    capabilities->compression = handshake.compression();
+    capabilities->max_message_size = handshake.max_message_size();
+    capabilities->multiplexing = handshake.multiplexing();
+    capabilities->checksum = handshake.checksum();
+    capabilities->ambiguous_method_ids.assign(handshake.ambiguous_method_ids().begin(),
+                                              handshake.ambiguous_method_ids().end());
+    std::sort(capabilities->ambiguous_method_ids.begin(), capabilities->ambiguous_method_ids.end());
+    return true;
+}
@@ -5,312 +5,670 @@
 
 #include <algorithm>
 
-#include <google/protobuf/stubs/common.h>
-#include <google/protobuf/stubs/port.h>
 #include <google/protobuf/io/coded_stream.h>
-#include <google/protobuf/wire_format_lite_inl.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
 #include <google/protobuf/descriptor.h>
 #include <google/protobuf/generated_message_reflection.h>
 #include <google/protobuf/reflection_ops.h>
 #include <google/protobuf/wire_format.h>
-// This is a temporary google only hack
-#ifdef GOOGLE_PROTOBUF_ENFORCE_UNIQUENESS
-#include "third_party/protobuf/version.h"
-#endif
 // @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
 
-namespace rpcheader {
-class RpcHeaderDefaultTypeInternal {
- public:
-  ::google::protobuf::internal::ExplicitlyConstructed<RpcHeader>
-      _instance;
-} _RpcHeader_default_instance_;
-}  // namespace rpcheader
-namespace protobuf_rpcheader_2eproto {
-static void InitDefaultsRpcHeader() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::rpcheader::_RpcHeader_default_instance_;
-    new (ptr) ::rpcheader::RpcHeader();
-    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::rpcheader::RpcHeader::InitAsDefaultInstance();
-}
-
-::google::protobuf::internal::SCCInfo<0> scc_info_RpcHeader =
-    {{ATOMIC_VAR_INIT(::google::protobuf::internal::SCCInfoBase::kUninitialized), 0, InitDefaultsRpcHeader}, {}};
+PROTOBUF_PRAGMA_INIT_SEG
 
-void InitDefaults() {
-  ::google::protobuf::internal::InitSCC(&scc_info_RpcHeader.base);
-}
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
 
-::google::protobuf::Metadata file_level_metadata[1];
+namespace rpcheader {
+PROTOBUF_CONSTEXPR RpcHeader::RpcHeader(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.service_name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.method_name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.tenant_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.metadata_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.request_id_)*/uint64_t{0u}
+  , /*decltype(_impl_.args_size_)*/0u
+  , /*decltype(_impl_.batch_count_)*/0u
+  , /*decltype(_impl_.one_way_)*/false
+  , /*decltype(_impl_.frame_type_)*/0
+  , /*decltype(_impl_.credit_)*/0u
+  , /*decltype(_impl_.compression_)*/0
+  , /*decltype(_impl_.uncompressed_size_)*/0u
+  , /*decltype(_impl_.method_id_)*/0u
+  , /*decltype(_impl_.timeout_ms_)*/0u
+  , /*decltype(_impl_.method_index_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct RpcHeaderDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR RpcHeaderDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~RpcHeaderDefaultTypeInternal() {}
+  union {
+    RpcHeader _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 RpcHeaderDefaultTypeInternal _RpcHeader_default_instance_;
+PROTOBUF_CONSTEXPR RpcResponseHeader::RpcResponseHeader(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.error_text_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.metadata_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.status_)*/0
+  , /*decltype(_impl_.body_size_)*/0u
+  , /*decltype(_impl_.request_id_)*/uint64_t{0u}
+  , /*decltype(_impl_.batch_count_)*/0u
+  , /*decltype(_impl_.frame_type_)*/0
+  , /*decltype(_impl_.credit_)*/0u
+  , /*decltype(_impl_.compression_)*/0
+  , /*decltype(_impl_.uncompressed_size_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct RpcResponseHeaderDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR RpcResponseHeaderDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~RpcResponseHeaderDefaultTypeInternal() {}
+  union {
+    RpcResponseHeader _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 RpcResponseHeaderDefaultTypeInternal _RpcResponseHeader_default_instance_;
+PROTOBUF_CONSTEXPR Handshake::Handshake(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.ambiguous_method_ids_)*/{}
+  , /*decltype(_impl_._ambiguous_method_ids_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.protocol_version_)*/0u
+  , /*decltype(_impl_.compression_)*/0u
+  , /*decltype(_impl_.max_message_size_)*/uint64_t{0u}
+  , /*decltype(_impl_.multiplexing_)*/false
+  , /*decltype(_impl_.checksum_)*/false
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct HandshakeDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR HandshakeDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~HandshakeDefaultTypeInternal() {}
+  union {
+    Handshake _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 HandshakeDefaultTypeInternal _Handshake_default_instance_;
+}  // namespace rpcheader
+static ::_pb::Metadata file_level_metadata_rpcheader_2eproto[3];
+static const ::_pb::EnumDescriptor* file_level_enum_descriptors_rpcheader_2eproto[3];
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_rpcheader_2eproto = nullptr;
 
-const ::google::protobuf::uint32 TableStruct::offsets[] GOOGLE_PROTOBUF_ATTRIBUTE_SECTION_VARIABLE(protodesc_cold) = {
+const uint32_t TableStruct_rpcheader_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::rpcheader::RpcHeader, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::rpcheader::RpcHeader, _impl_.service_name_),
+  PROTOBUF_FIELD_OFFSET(::rpcheader::RpcHeader, _impl_.method_name_),
+  PROTOBUF_FIELD_OFFSET(::rpcheader::RpcHeader, _impl_.args_size_),
+  PROTOBUF_FIELD_OFFSET(::rpcheader::RpcHeader, _impl_.request_id_),
+  PROTOBUF_FIELD_OFFSET(::rpcheader::RpcHeader, _impl_.tenant_),
+  PROTOBUF_FIELD_OFFSET(::rpcheader::RpcHeader, _impl_.batch_count_),
+  PROTOBUF_FIELD_OFFSET(::rpcheader::RpcHeader, _impl_.one_way_),
+  PROTOBUF_FIELD_OFFSET(::rpcheader::RpcHeader, _impl_.frame_type_),
+  PROTOBUF_FIELD_OFFSET(::rpcheader::RpcHeader, _impl_.credit_),
+  PROTOBUF_FIELD_OFFSET(::rpcheader::RpcHeader, _impl_.compression_),
+  PROTOBUF_FIELD_OFFSET(::rpcheader::RpcHeader, _impl_.uncompressed_size_),
+  PROTOBUF_FIELD_OFFSET(::rpcheader::RpcHeader, _impl_.method_id_),
+  PROTOBUF_FIELD_OFFSET(::rpcheader::RpcHeader, _impl_.timeout_ms_),
+  PROTOBUF_FIELD_OFFSET(::rpcheader::RpcHeader, _impl_.method_index_),
+  PROTOBUF_FIELD_OFFSET(::rpcheader::RpcHeader, _impl_.metadata_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::rpcheader::RpcResponseHeader, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::rpcheader::RpcResponseHeader, _impl_.status_),
+  PROTOBUF_FIELD_OFFSET(::rpcheader::RpcResponseHeader, _impl_.error_text_),
+  PROTOBUF_FIELD_OFFSET(::rpcheader::RpcResponseHeader, _impl_.body_size_),
+  PROTOBUF_FIELD_OFFSET(::rpcheader::RpcResponseHeader, _impl_.request_id_),
+  PROTOBUF_FIELD_OFFSET(::rpcheader::RpcResponseHeader, _impl_.batch_count_),
+  PROTOBUF_FIELD_OFFSET(::rpcheader::RpcResponseHeader, _impl_.frame_type_),
+  PROTOBUF_FIELD_OFFSET(::rpcheader::RpcResponseHeader, _impl_.credit_),
+  PROTOBUF_FIELD_OFFSET(::rpcheader::RpcResponseHeader, _impl_.compression_),
+  PROTOBUF_FIELD_OFFSET(::rpcheader::RpcResponseHeader, _impl_.uncompressed_size_),
+  PROTOBUF_FIELD_OFFSET(::rpcheader::RpcResponseHeader, _impl_.metadata_),
   ~0u,  // no _has_bits_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::rpcheader::RpcHeader, _internal_metadata_),
+  PROTOBUF_FIELD_OFFSET(::rpcheader::Handshake, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::rpcheader::RpcHeader, service_name_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::rpcheader::RpcHeader, method_name_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::rpcheader::RpcHeader, args_size_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::rpcheader::Handshake, _impl_.protocol_version_),
+  PROTOBUF_FIELD_OFFSET(::rpcheader::Handshake, _impl_.compression_),
+  PROTOBUF_FIELD_OFFSET(::rpcheader::Handshake, _impl_.max_message_size_),
+  PROTOBUF_FIELD_OFFSET(::rpcheader::Handshake, _impl_.multiplexing_),
+  PROTOBUF_FIELD_OFFSET(::rpcheader::Handshake, _impl_.checksum_),
+  PROTOBUF_FIELD_OFFSET(::rpcheader::Handshake, _impl_.ambiguous_method_ids_),
 };
-static const ::google::protobuf::internal::MigrationSchema schemas[] GOOGLE_PROTOBUF_ATTRIBUTE_SECTION_VARIABLE(protodesc_cold) = {
-  { 0, -1, sizeof(::rpcheader::RpcHeader)},
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, -1, -1, sizeof(::rpcheader::RpcHeader)},
+  { 21, -1, -1, sizeof(::rpcheader::RpcResponseHeader)},
+  { 37, -1, -1, sizeof(::rpcheader::Handshake)},
 };
 
-static ::google::protobuf::Message const * const file_default_instances[] = {
-  reinterpret_cast<const ::google::protobuf::Message*>(&::rpcheader::_RpcHeader_default_instance_),
+static const ::_pb::Message* const file_default_instances[] = {
+  &::rpcheader::_RpcHeader_default_instance_._instance,
+  &::rpcheader::_RpcResponseHeader_default_instance_._instance,
+  &::rpcheader::_Handshake_default_instance_._instance,
 };
 
-void protobuf_AssignDescriptors() {
-  AddDescriptors();
-  AssignDescriptors(
-      "rpcheader.proto", schemas, file_default_instances, TableStruct::offsets,
-      file_level_metadata, NULL, NULL);
+const char descriptor_table_protodef_rpcheader_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\017rpcheader.proto\022\trpcheader\"\356\002\n\tRpcHead"
+  "er\022\024\n\014service_name\030\001 \001(\014\022\023\n\013method_name\030"
+  "\002 \001(\014\022\021\n\targs_size\030\003 \001(\r\022\022\n\nrequest_id\030\004"
+  " \001(\004\022\016\n\006tenant\030\005 \001(\014\022\023\n\013batch_count\030\006 \001("
+  "\r\022\017\n\007one_way\030\007 \001(\010\022(\n\nframe_type\030\010 \001(\0162\024"
+  ".rpcheader.FrameType\022\016\n\006credit\030\t \001(\r\022/\n\013"
+  "compression\030\n \001(\0162\032.rpcheader.Compressio"
+  "nType\022\031\n\021uncompressed_size\030\013 \001(\r\022\021\n\tmeth"
+  "od_id\030\r \001(\r\022\022\n\ntimeout_ms\030\016 \001(\r\022\024\n\014metho"
+  "d_index\030\017 \001(\r\022\020\n\010metadata\030\020 \001(\014J\004\010\014\020\r\"\255\002"
+  "\n\021RpcResponseHeader\022$\n\006status\030\001 \001(\0162\024.rp"
+  "cheader.RpcStatus\022\022\n\nerror_text\030\002 \001(\014\022\021\n"
+  "\tbody_size\030\003 \001(\r\022\022\n\nrequest_id\030\004 \001(\004\022\023\n\013"
+  "batch_count\030\005 \001(\r\022(\n\nframe_type\030\006 \001(\0162\024."
+  "rpcheader.FrameType\022\016\n\006credit\030\007 \001(\r\022/\n\013c"
+  "ompression\030\010 \001(\0162\032.rpcheader.Compression"
+  "Type\022\031\n\021uncompressed_size\030\t \001(\r\022\020\n\010metad"
+  "ata\030\014 \001(\014J\004\010\n\020\013J\004\010\013\020\014\"\232\001\n\tHandshake\022\030\n\020p"
+  "rotocol_version\030\001 \001(\r\022\023\n\013compression\030\002 \001"
+  "(\r\022\030\n\020max_message_size\030\003 \001(\004\022\024\n\014multiple"
+  "xing\030\004 \001(\010\022\020\n\010checksum\030\005 \001(\010\022\034\n\024ambiguou"
+  "s_method_ids\030\006 \003(\r*\243\001\n\tFrameType\022\017\n\013FRAM"
+  "E_UNARY\020\000\022\030\n\024FRAME_STREAM_MESSAGE\020\001\022\027\n\023F"
+  "RAME_STREAM_CREDIT\020\002\022\024\n\020FRAME_STREAM_END"
+  "\020\003\022\017\n\013FRAME_CHUNK\020\004\022\023\n\017FRAME_HANDSHAKE\020\005"
+  "\022\026\n\022FRAME_STREAM_RESET\020\006*\\\n\017CompressionT"
+  "ype\022\021\n\rCOMPRESS_NONE\020\000\022\020\n\014COMPRESS_LZ4\020\001"
+  "\022\021\n\rCOMPRESS_ZSTD\020\002\022\021\n\rCOMPRESS_ZLIB\020\003*\274"
+  "\001\n\tRpcStatus\022\n\n\006RPC_OK\020\000\022\023\n\017RPC_SERVER_B"
+  "USY\020\001\022\022\n\016RPC_OVERLOADED\020\002\022\031\n\025RPC_SERVICE"
+  "_NOT_FOUND\020\003\022\030\n\024RPC_METHOD_NOT_FOUND\020\004\022\023"
+  "\n\017RPC_BAD_REQUEST\020\005\022\025\n\021RPC_METHOD_FAILED"
+  "\020\006\022\031\n\025RPC_DEADLINE_EXCEEDED\020\007b\006proto3"
+  ;
+static ::_pbi::once_flag descriptor_table_rpcheader_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_rpcheader_2eproto = {
+    false, false, 1317, descriptor_table_protodef_rpcheader_2eproto,
+    "rpcheader.proto",
+    &descriptor_table_rpcheader_2eproto_once, nullptr, 0, 3,
+    schemas, file_default_instances, TableStruct_rpcheader_2eproto::offsets,
+    file_level_metadata_rpcheader_2eproto, file_level_enum_descriptors_rpcheader_2eproto,
+    file_level_service_descriptors_rpcheader_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_rpcheader_2eproto_getter() {
+  return &descriptor_table_rpcheader_2eproto;
 }
 
-void protobuf_AssignDescriptorsOnce() {
-  static ::google::protobuf::internal::once_flag once;
-  ::google::protobuf::internal::call_once(once, protobuf_AssignDescriptors);
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_rpcheader_2eproto(&descriptor_table_rpcheader_2eproto);
+namespace rpcheader {
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* FrameType_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_rpcheader_2eproto);
+  return file_level_enum_descriptors_rpcheader_2eproto[0];
 }
-
-void protobuf_RegisterTypes(const ::std::string&) GOOGLE_PROTOBUF_ATTRIBUTE_COLD;
-void protobuf_RegisterTypes(const ::std::string&) {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::internal::RegisterAllTypes(file_level_metadata, 1);
+bool FrameType_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+    case 2:
+    case 3:
+    case 4:
+    case 5:
+    case 6:
+      return true;
+    default:
+      return false;
+  }
 }
 
-void AddDescriptorsImpl() {
-  InitDefaults();
-  static const char descriptor[] GOOGLE_PROTOBUF_ATTRIBUTE_SECTION_VARIABLE(protodesc_cold) = {
-      "\n\017rpcheader.proto\022\trpcheader\"I\n\tRpcHeade"
-      "r\022\024\n\014service_name\030\001 \001(\014\022\023\n\013method_name\030\002"
-      " \001(\014\022\021\n\targs_size\030\003 \001(\rb\006proto3"
-  };
-  ::google::protobuf::DescriptorPool::InternalAddGeneratedFile(
-      descriptor, 111);
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedFile(
-    "rpcheader.proto", &protobuf_RegisterTypes);
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* CompressionType_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_rpcheader_2eproto);
+  return file_level_enum_descriptors_rpcheader_2eproto[1];
+}
+bool CompressionType_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+    case 2:
+    case 3:
+      return true;
+    default:
+      return false;
+  }
 }
 
-void AddDescriptors() {
-  static ::google::protobuf::internal::once_flag once;
-  ::google::protobuf::internal::call_once(once, AddDescriptorsImpl);
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* RpcStatus_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_rpcheader_2eproto);
+  return file_level_enum_descriptors_rpcheader_2eproto[2];
 }
-// Force AddDescriptors() to be called at dynamic initialization time.
-struct StaticDescriptorInitializer {
-  StaticDescriptorInitializer() {
-    AddDescriptors();
+bool RpcStatus_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+    case 2:
+    case 3:
+    case 4:
+    case 5:
+    case 6:
+    case 7:
+      return true;
+    default:
+      return false;
   }
-} static_descriptor_initializer;
-}  // namespace protobuf_rpcheader_2eproto
-namespace rpcheader {
+}
+
 
 // ===================================================================
 
-void RpcHeader::InitAsDefaultInstance() {
-}
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int RpcHeader::kServiceNameFieldNumber;
-const int RpcHeader::kMethodNameFieldNumber;
-const int RpcHeader::kArgsSizeFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+class RpcHeader::_Internal {
+ public:
+};
 
-RpcHeader::RpcHeader()
-  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
-  ::google::protobuf::internal::InitSCC(
-      &protobuf_rpcheader_2eproto::scc_info_RpcHeader.base);
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:rpcheader.RpcHeader)
+RpcHeader::RpcHeader(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:rpcheader.RpcHeader)
 }
 RpcHeader::RpcHeader(const RpcHeader& from)
-  : ::google::protobuf::Message(),
-      _internal_metadata_(NULL) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  service_name_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (from.service_name().size() > 0) {
-    service_name_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.service_name_);
-  }
-  method_name_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (from.method_name().size() > 0) {
-    method_name_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.method_name_);
-  }
-  args_size_ = from.args_size_;
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  RpcHeader* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.service_name_){}
+    , decltype(_impl_.method_name_){}
+    , decltype(_impl_.tenant_){}
+    , decltype(_impl_.metadata_){}
+    , decltype(_impl_.request_id_){}
+    , decltype(_impl_.args_size_){}
+    , decltype(_impl_.batch_count_){}
+    , decltype(_impl_.one_way_){}
+    , decltype(_impl_.frame_type_){}
+    , decltype(_impl_.credit_){}
+    , decltype(_impl_.compression_){}
+    , decltype(_impl_.uncompressed_size_){}
+    , decltype(_impl_.method_id_){}
+    , decltype(_impl_.timeout_ms_){}
+    , decltype(_impl_.method_index_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.service_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.service_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_service_name().empty()) {
+    _this->_impl_.service_name_.Set(from._internal_service_name(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.method_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.method_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_method_name().empty()) {
+    _this->_impl_.method_name_.Set(from._internal_method_name(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.tenant_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.tenant_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_tenant().empty()) {
+    _this->_impl_.tenant_.Set(from._internal_tenant(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.metadata_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.metadata_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_metadata().empty()) {
+    _this->_impl_.metadata_.Set(from._internal_metadata(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.request_id_, &from._impl_.request_id_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.method_index_) -
+    reinterpret_cast<char*>(&_impl_.request_id_)) + sizeof(_impl_.method_index_));
   // @@protoc_insertion_point(copy_constructor:rpcheader.RpcHeader)
 }
 
-void RpcHeader::SharedCtor() {
-  service_name_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  method_name_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  args_size_ = 0u;
+inline void RpcHeader::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.service_name_){}
+    , decltype(_impl_.method_name_){}
+    , decltype(_impl_.tenant_){}
+    , decltype(_impl_.metadata_){}
+    , decltype(_impl_.request_id_){uint64_t{0u}}
+    , decltype(_impl_.args_size_){0u}
+    , decltype(_impl_.batch_count_){0u}
+    , decltype(_impl_.one_way_){false}
+    , decltype(_impl_.frame_type_){0}
+    , decltype(_impl_.credit_){0u}
+    , decltype(_impl_.compression_){0}
+    , decltype(_impl_.uncompressed_size_){0u}
+    , decltype(_impl_.method_id_){0u}
+    , decltype(_impl_.timeout_ms_){0u}
+    , decltype(_impl_.method_index_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.service_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.service_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.method_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.method_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.tenant_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.tenant_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.metadata_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.metadata_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 RpcHeader::~RpcHeader() {
   // @@protoc_insertion_point(destructor:rpcheader.RpcHeader)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void RpcHeader::SharedDtor() {
-  service_name_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  method_name_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline void RpcHeader::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.service_name_.Destroy();
+  _impl_.method_name_.Destroy();
+  _impl_.tenant_.Destroy();
+  _impl_.metadata_.Destroy();
 }
 
 void RpcHeader::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const ::google::protobuf::Descriptor* RpcHeader::descriptor() {
-  ::protobuf_rpcheader_2eproto::protobuf_AssignDescriptorsOnce();
-  return ::protobuf_rpcheader_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
+  _impl_._cached_size_.Set(size);
 }
 
-const RpcHeader& RpcHeader::default_instance() {
-  ::google::protobuf::internal::InitSCC(&protobuf_rpcheader_2eproto::scc_info_RpcHeader.base);
-  return *internal_default_instance();
-}
-
-
 void RpcHeader::Clear() {
 // @@protoc_insertion_point(message_clear_start:rpcheader.RpcHeader)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  service_name_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  method_name_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  args_size_ = 0u;
-  _internal_metadata_.Clear();
-}
-
-bool RpcHeader::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:rpcheader.RpcHeader)
-  for (;;) {
-    ::std::pair<::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+  _impl_.service_name_.ClearToEmpty();
+  _impl_.method_name_.ClearToEmpty();
+  _impl_.tenant_.ClearToEmpty();
+  _impl_.metadata_.ClearToEmpty();
+  ::memset(&_impl_.request_id_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.method_index_) -
+      reinterpret_cast<char*>(&_impl_.request_id_)) + sizeof(_impl_.method_index_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* RpcHeader::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // bytes service_name = 1;
-      case 1: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(10u /* 10 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadBytes(
-                input, this->mutable_service_name()));
-        } else {
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_service_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // bytes method_name = 2;
-      case 2: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(18u /* 18 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadBytes(
-                input, this->mutable_method_name()));
-        } else {
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_method_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // uint32 args_size = 3;
-      case 3: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(24u /* 24 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
-                 input, &args_size_)));
-        } else {
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.args_size_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 request_id = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.request_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes tenant = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          auto str = _internal_mutable_tenant();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 batch_count = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _impl_.batch_count_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bool one_way = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _impl_.one_way_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .rpcheader.FrameType frame_type = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 64)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_frame_type(static_cast<::rpcheader::FrameType>(val));
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, _internal_metadata_.mutable_unknown_fields()));
-        break;
-      }
+        continue;
+      // uint32 credit = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 72)) {
+          _impl_.credit_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .rpcheader.CompressionType compression = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 80)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_compression(static_cast<::rpcheader::CompressionType>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 uncompressed_size = 11;
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 88)) {
+          _impl_.uncompressed_size_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 method_id = 13;
+      case 13:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 104)) {
+          _impl_.method_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 timeout_ms = 14;
+      case 14:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 112)) {
+          _impl_.timeout_ms_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 method_index = 15;
+      case 15:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 120)) {
+          _impl_.method_index_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes metadata = 16;
+      case 16:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 130)) {
+          auto str = _internal_mutable_metadata();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:rpcheader.RpcHeader)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:rpcheader.RpcHeader)
-  return false;
-#undef DO_
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-void RpcHeader::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:rpcheader.RpcHeader)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+uint8_t* RpcHeader::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:rpcheader.RpcHeader)
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // bytes service_name = 1;
-  if (this->service_name().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteBytesMaybeAliased(
-      1, this->service_name(), output);
+  if (!this->_internal_service_name().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        1, this->_internal_service_name(), target);
   }
 
   // bytes method_name = 2;
-  if (this->method_name().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteBytesMaybeAliased(
-      2, this->method_name(), output);
+  if (!this->_internal_method_name().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        2, this->_internal_method_name(), target);
   }
 
   // uint32 args_size = 3;
-  if (this->args_size() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt32(3, this->args_size(), output);
+  if (this->_internal_args_size() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(3, this->_internal_args_size(), target);
   }
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), output);
+  // uint64 request_id = 4;
+  if (this->_internal_request_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(4, this->_internal_request_id(), target);
   }
-  // @@protoc_insertion_point(serialize_end:rpcheader.RpcHeader)
-}
 
-::google::protobuf::uint8* RpcHeader::InternalSerializeWithCachedSizesToArray(
-    bool deterministic, ::google::protobuf::uint8* target) const {
-  (void)deterministic; // Unused
-  // @@protoc_insertion_point(serialize_to_array_start:rpcheader.RpcHeader)
-  ::google::protobuf::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
+  // bytes tenant = 5;
+  if (!this->_internal_tenant().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        5, this->_internal_tenant(), target);
+  }
 
-  // bytes service_name = 1;
-  if (this->service_name().size() > 0) {
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteBytesToArray(
-        1, this->service_name(), target);
+  // uint32 batch_count = 6;
+  if (this->_internal_batch_count() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(6, this->_internal_batch_count(), target);
   }
 
-  // bytes method_name = 2;
-  if (this->method_name().size() > 0) {
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteBytesToArray(
-        2, this->method_name(), target);
+  // bool one_way = 7;
+  if (this->_internal_one_way() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(7, this->_internal_one_way(), target);
   }
 
-  // uint32 args_size = 3;
-  if (this->args_size() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(3, this->args_size(), target);
+  // .rpcheader.FrameType frame_type = 8;
+  if (this->_internal_frame_type() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      8, this->_internal_frame_type(), target);
+  }
+
+  // uint32 credit = 9;
+  if (this->_internal_credit() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(9, this->_internal_credit(), target);
+  }
+
+  // .rpcheader.CompressionType compression = 10;
+  if (this->_internal_compression() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      10, this->_internal_compression(), target);
+  }
+
+  // uint32 uncompressed_size = 11;
+  if (this->_internal_uncompressed_size() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(11, this->_internal_uncompressed_size(), target);
   }
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), target);
+  // uint32 method_id = 13;
+  if (this->_internal_method_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(13, this->_internal_method_id(), target);
+  }
+
+  // uint32 timeout_ms = 14;
+  if (this->_internal_timeout_ms() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(14, this->_internal_timeout_ms(), target);
+  }
+
+  // uint32 method_index = 15;
+  if (this->_internal_method_index() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(15, this->_internal_method_index(), target);
+  }
+
+  // bytes metadata = 16;
+  if (!this->_internal_metadata().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        16, this->_internal_metadata(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:rpcheader.RpcHeader)
   return target;
@@ -320,118 +678,1004 @@ size_t RpcHeader::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:rpcheader.RpcHeader)
   size_t total_size = 0;
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()));
-  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
   // bytes service_name = 1;
-  if (this->service_name().size() > 0) {
+  if (!this->_internal_service_name().empty()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::BytesSize(
-        this->service_name());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_service_name());
   }
 
   // bytes method_name = 2;
-  if (this->method_name().size() > 0) {
+  if (!this->_internal_method_name().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_method_name());
+  }
+
+  // bytes tenant = 5;
+  if (!this->_internal_tenant().empty()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::BytesSize(
-        this->method_name());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_tenant());
+  }
+
+  // bytes metadata = 16;
+  if (!this->_internal_metadata().empty()) {
+    total_size += 2 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_metadata());
+  }
+
+  // uint64 request_id = 4;
+  if (this->_internal_request_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_request_id());
   }
 
   // uint32 args_size = 3;
-  if (this->args_size() != 0) {
+  if (this->_internal_args_size() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_args_size());
+  }
+
+  // uint32 batch_count = 6;
+  if (this->_internal_batch_count() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_batch_count());
+  }
+
+  // bool one_way = 7;
+  if (this->_internal_one_way() != 0) {
+    total_size += 1 + 1;
+  }
+
+  // .rpcheader.FrameType frame_type = 8;
+  if (this->_internal_frame_type() != 0) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::UInt32Size(
-        this->args_size());
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_frame_type());
+  }
+
+  // uint32 credit = 9;
+  if (this->_internal_credit() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_credit());
+  }
+
+  // .rpcheader.CompressionType compression = 10;
+  if (this->_internal_compression() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_compression());
+  }
+
+  // uint32 uncompressed_size = 11;
+  if (this->_internal_uncompressed_size() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_uncompressed_size());
+  }
+
+  // uint32 method_id = 13;
+  if (this->_internal_method_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_method_id());
+  }
+
+  // uint32 timeout_ms = 14;
+  if (this->_internal_timeout_ms() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_timeout_ms());
+  }
+
+  // uint32 method_index = 15;
+  if (this->_internal_method_index() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_method_index());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData RpcHeader::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    RpcHeader::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*RpcHeader::GetClassData() const { return &_class_data_; }
+
+
+void RpcHeader::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<RpcHeader*>(&to_msg);
+  auto& from = static_cast<const RpcHeader&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:rpcheader.RpcHeader)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_service_name().empty()) {
+    _this->_internal_set_service_name(from._internal_service_name());
+  }
+  if (!from._internal_method_name().empty()) {
+    _this->_internal_set_method_name(from._internal_method_name());
+  }
+  if (!from._internal_tenant().empty()) {
+    _this->_internal_set_tenant(from._internal_tenant());
+  }
+  if (!from._internal_metadata().empty()) {
+    _this->_internal_set_metadata(from._internal_metadata());
+  }
+  if (from._internal_request_id() != 0) {
+    _this->_internal_set_request_id(from._internal_request_id());
+  }
+  if (from._internal_args_size() != 0) {
+    _this->_internal_set_args_size(from._internal_args_size());
+  }
+  if (from._internal_batch_count() != 0) {
+    _this->_internal_set_batch_count(from._internal_batch_count());
+  }
+  if (from._internal_one_way() != 0) {
+    _this->_internal_set_one_way(from._internal_one_way());
+  }
+  if (from._internal_frame_type() != 0) {
+    _this->_internal_set_frame_type(from._internal_frame_type());
+  }
+  if (from._internal_credit() != 0) {
+    _this->_internal_set_credit(from._internal_credit());
+  }
+  if (from._internal_compression() != 0) {
+    _this->_internal_set_compression(from._internal_compression());
   }
+  if (from._internal_uncompressed_size() != 0) {
+    _this->_internal_set_uncompressed_size(from._internal_uncompressed_size());
+  }
+  if (from._internal_method_id() != 0) {
+    _this->_internal_set_method_id(from._internal_method_id());
+  }
+  if (from._internal_timeout_ms() != 0) {
+    _this->_internal_set_timeout_ms(from._internal_timeout_ms());
+  }
+  if (from._internal_method_index() != 0) {
+    _this->_internal_set_method_index(from._internal_method_index());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void RpcHeader::CopyFrom(const RpcHeader& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:rpcheader.RpcHeader)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool RpcHeader::IsInitialized() const {
+  return true;
+}
+
+void RpcHeader::InternalSwap(RpcHeader* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.service_name_, lhs_arena,
+      &other->_impl_.service_name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.method_name_, lhs_arena,
+      &other->_impl_.method_name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.tenant_, lhs_arena,
+      &other->_impl_.tenant_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.metadata_, lhs_arena,
+      &other->_impl_.metadata_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(RpcHeader, _impl_.method_index_)
+      + sizeof(RpcHeader::_impl_.method_index_)
+      - PROTOBUF_FIELD_OFFSET(RpcHeader, _impl_.request_id_)>(
+          reinterpret_cast<char*>(&_impl_.request_id_),
+          reinterpret_cast<char*>(&other->_impl_.request_id_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata RpcHeader::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_rpcheader_2eproto_getter, &descriptor_table_rpcheader_2eproto_once,
+      file_level_metadata_rpcheader_2eproto[0]);
+}
+
+// ===================================================================
+
+class RpcResponseHeader::_Internal {
+ public:
+};
+
+RpcResponseHeader::RpcResponseHeader(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:rpcheader.RpcResponseHeader)
+}
+RpcResponseHeader::RpcResponseHeader(const RpcResponseHeader& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  RpcResponseHeader* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.error_text_){}
+    , decltype(_impl_.metadata_){}
+    , decltype(_impl_.status_){}
+    , decltype(_impl_.body_size_){}
+    , decltype(_impl_.request_id_){}
+    , decltype(_impl_.batch_count_){}
+    , decltype(_impl_.frame_type_){}
+    , decltype(_impl_.credit_){}
+    , decltype(_impl_.compression_){}
+    , decltype(_impl_.uncompressed_size_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.error_text_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.error_text_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_error_text().empty()) {
+    _this->_impl_.error_text_.Set(from._internal_error_text(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.metadata_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.metadata_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_metadata().empty()) {
+    _this->_impl_.metadata_.Set(from._internal_metadata(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.status_, &from._impl_.status_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.uncompressed_size_) -
+    reinterpret_cast<char*>(&_impl_.status_)) + sizeof(_impl_.uncompressed_size_));
+  // @@protoc_insertion_point(copy_constructor:rpcheader.RpcResponseHeader)
+}
+
+inline void RpcResponseHeader::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.error_text_){}
+    , decltype(_impl_.metadata_){}
+    , decltype(_impl_.status_){0}
+    , decltype(_impl_.body_size_){0u}
+    , decltype(_impl_.request_id_){uint64_t{0u}}
+    , decltype(_impl_.batch_count_){0u}
+    , decltype(_impl_.frame_type_){0}
+    , decltype(_impl_.credit_){0u}
+    , decltype(_impl_.compression_){0}
+    , decltype(_impl_.uncompressed_size_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.error_text_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.error_text_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.metadata_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.metadata_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+RpcResponseHeader::~RpcResponseHeader() {
+  // @@protoc_insertion_point(destructor:rpcheader.RpcResponseHeader)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void RpcResponseHeader::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.error_text_.Destroy();
+  _impl_.metadata_.Destroy();
+}
+
+void RpcResponseHeader::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void RpcResponseHeader::Clear() {
+// @@protoc_insertion_point(message_clear_start:rpcheader.RpcResponseHeader)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
+  _impl_.error_text_.ClearToEmpty();
+  _impl_.metadata_.ClearToEmpty();
+  ::memset(&_impl_.status_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.uncompressed_size_) -
+      reinterpret_cast<char*>(&_impl_.status_)) + sizeof(_impl_.uncompressed_size_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void RpcHeader::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:rpcheader.RpcHeader)
-  GOOGLE_DCHECK_NE(&from, this);
-  const RpcHeader* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const RpcHeader>(
-          &from);
-  if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:rpcheader.RpcHeader)
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:rpcheader.RpcHeader)
-    MergeFrom(*source);
+const char* RpcResponseHeader::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // .rpcheader.RpcStatus status = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_status(static_cast<::rpcheader::RpcStatus>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes error_text = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_error_text();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 body_size = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.body_size_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 request_id = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.request_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 batch_count = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.batch_count_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .rpcheader.FrameType frame_type = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_frame_type(static_cast<::rpcheader::FrameType>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 credit = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _impl_.credit_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .rpcheader.CompressionType compression = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 64)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_compression(static_cast<::rpcheader::CompressionType>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 uncompressed_size = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 72)) {
+          _impl_.uncompressed_size_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes metadata = 12;
+      case 12:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 98)) {
+          auto str = _internal_mutable_metadata();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* RpcResponseHeader::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:rpcheader.RpcResponseHeader)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .rpcheader.RpcStatus status = 1;
+  if (this->_internal_status() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      1, this->_internal_status(), target);
+  }
+
+  // bytes error_text = 2;
+  if (!this->_internal_error_text().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        2, this->_internal_error_text(), target);
+  }
+
+  // uint32 body_size = 3;
+  if (this->_internal_body_size() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(3, this->_internal_body_size(), target);
+  }
+
+  // uint64 request_id = 4;
+  if (this->_internal_request_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(4, this->_internal_request_id(), target);
+  }
+
+  // uint32 batch_count = 5;
+  if (this->_internal_batch_count() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(5, this->_internal_batch_count(), target);
+  }
+
+  // .rpcheader.FrameType frame_type = 6;
+  if (this->_internal_frame_type() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      6, this->_internal_frame_type(), target);
+  }
+
+  // uint32 credit = 7;
+  if (this->_internal_credit() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(7, this->_internal_credit(), target);
+  }
+
+  // .rpcheader.CompressionType compression = 8;
+  if (this->_internal_compression() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      8, this->_internal_compression(), target);
   }
+
+  // uint32 uncompressed_size = 9;
+  if (this->_internal_uncompressed_size() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(9, this->_internal_uncompressed_size(), target);
+  }
+
+  // bytes metadata = 12;
+  if (!this->_internal_metadata().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        12, this->_internal_metadata(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:rpcheader.RpcResponseHeader)
+  return target;
 }
 
-void RpcHeader::MergeFrom(const RpcHeader& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:rpcheader.RpcHeader)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::google::protobuf::uint32 cached_has_bits = 0;
+size_t RpcResponseHeader::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:rpcheader.RpcResponseHeader)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  if (from.service_name().size() > 0) {
+  // bytes error_text = 2;
+  if (!this->_internal_error_text().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_error_text());
+  }
+
+  // bytes metadata = 12;
+  if (!this->_internal_metadata().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_metadata());
+  }
+
+  // .rpcheader.RpcStatus status = 1;
+  if (this->_internal_status() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_status());
+  }
+
+  // uint32 body_size = 3;
+  if (this->_internal_body_size() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_body_size());
+  }
+
+  // uint64 request_id = 4;
+  if (this->_internal_request_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_request_id());
+  }
+
+  // uint32 batch_count = 5;
+  if (this->_internal_batch_count() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_batch_count());
+  }
 
-    service_name_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.service_name_);
+  // .rpcheader.FrameType frame_type = 6;
+  if (this->_internal_frame_type() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_frame_type());
   }
-  if (from.method_name().size() > 0) {
 
-    method_name_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.method_name_);
+  // uint32 credit = 7;
+  if (this->_internal_credit() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_credit());
+  }
+
+  // .rpcheader.CompressionType compression = 8;
+  if (this->_internal_compression() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_compression());
+  }
+
+  // uint32 uncompressed_size = 9;
+  if (this->_internal_uncompressed_size() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_uncompressed_size());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData RpcResponseHeader::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    RpcResponseHeader::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*RpcResponseHeader::GetClassData() const { return &_class_data_; }
+
+
+void RpcResponseHeader::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<RpcResponseHeader*>(&to_msg);
+  auto& from = static_cast<const RpcResponseHeader&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:rpcheader.RpcResponseHeader)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_error_text().empty()) {
+    _this->_internal_set_error_text(from._internal_error_text());
+  }
+  if (!from._internal_metadata().empty()) {
+    _this->_internal_set_metadata(from._internal_metadata());
+  }
+  if (from._internal_status() != 0) {
+    _this->_internal_set_status(from._internal_status());
+  }
+  if (from._internal_body_size() != 0) {
+    _this->_internal_set_body_size(from._internal_body_size());
+  }
+  if (from._internal_request_id() != 0) {
+    _this->_internal_set_request_id(from._internal_request_id());
   }
-  if (from.args_size() != 0) {
-    set_args_size(from.args_size());
+  if (from._internal_batch_count() != 0) {
+    _this->_internal_set_batch_count(from._internal_batch_count());
   }
+  if (from._internal_frame_type() != 0) {
+    _this->_internal_set_frame_type(from._internal_frame_type());
+  }
+  if (from._internal_credit() != 0) {
+    _this->_internal_set_credit(from._internal_credit());
+  }
+  if (from._internal_compression() != 0) {
+    _this->_internal_set_compression(from._internal_compression());
+  }
+  if (from._internal_uncompressed_size() != 0) {
+    _this->_internal_set_uncompressed_size(from._internal_uncompressed_size());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void RpcHeader::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:rpcheader.RpcHeader)
+void RpcResponseHeader::CopyFrom(const RpcResponseHeader& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:rpcheader.RpcResponseHeader)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void RpcHeader::CopyFrom(const RpcHeader& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:rpcheader.RpcHeader)
+bool RpcResponseHeader::IsInitialized() const {
+  return true;
+}
+
+void RpcResponseHeader::InternalSwap(RpcResponseHeader* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.error_text_, lhs_arena,
+      &other->_impl_.error_text_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.metadata_, lhs_arena,
+      &other->_impl_.metadata_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(RpcResponseHeader, _impl_.uncompressed_size_)
+      + sizeof(RpcResponseHeader::_impl_.uncompressed_size_)
+      - PROTOBUF_FIELD_OFFSET(RpcResponseHeader, _impl_.status_)>(
+          reinterpret_cast<char*>(&_impl_.status_),
+          reinterpret_cast<char*>(&other->_impl_.status_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata RpcResponseHeader::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_rpcheader_2eproto_getter, &descriptor_table_rpcheader_2eproto_once,
+      file_level_metadata_rpcheader_2eproto[1]);
+}
+
+// ===================================================================
+
+class Handshake::_Internal {
+ public:
+};
+
+Handshake::Handshake(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:rpcheader.Handshake)
+}
+Handshake::Handshake(const Handshake& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Handshake* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.ambiguous_method_ids_){from._impl_.ambiguous_method_ids_}
+    , /*decltype(_impl_._ambiguous_method_ids_cached_byte_size_)*/{0}
+    , decltype(_impl_.protocol_version_){}
+    , decltype(_impl_.compression_){}
+    , decltype(_impl_.max_message_size_){}
+    , decltype(_impl_.multiplexing_){}
+    , decltype(_impl_.checksum_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.protocol_version_, &from._impl_.protocol_version_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.checksum_) -
+    reinterpret_cast<char*>(&_impl_.protocol_version_)) + sizeof(_impl_.checksum_));
+  // @@protoc_insertion_point(copy_constructor:rpcheader.Handshake)
+}
+
+inline void Handshake::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.ambiguous_method_ids_){arena}
+    , /*decltype(_impl_._ambiguous_method_ids_cached_byte_size_)*/{0}
+    , decltype(_impl_.protocol_version_){0u}
+    , decltype(_impl_.compression_){0u}
+    , decltype(_impl_.max_message_size_){uint64_t{0u}}
+    , decltype(_impl_.multiplexing_){false}
+    , decltype(_impl_.checksum_){false}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+Handshake::~Handshake() {
+  // @@protoc_insertion_point(destructor:rpcheader.Handshake)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Handshake::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.ambiguous_method_ids_.~RepeatedField();
+}
+
+void Handshake::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Handshake::Clear() {
+// @@protoc_insertion_point(message_clear_start:rpcheader.Handshake)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.ambiguous_method_ids_.Clear();
+  ::memset(&_impl_.protocol_version_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.checksum_) -
+      reinterpret_cast<char*>(&_impl_.protocol_version_)) + sizeof(_impl_.checksum_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Handshake::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint32 protocol_version = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.protocol_version_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 compression = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.compression_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 max_message_size = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.max_message_size_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bool multiplexing = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.multiplexing_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bool checksum = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.checksum_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated uint32 ambiguous_method_ids = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt32Parser(_internal_mutable_ambiguous_method_ids(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 48) {
+          _internal_add_ambiguous_method_ids(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Handshake::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:rpcheader.Handshake)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint32 protocol_version = 1;
+  if (this->_internal_protocol_version() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_protocol_version(), target);
+  }
+
+  // uint32 compression = 2;
+  if (this->_internal_compression() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_compression(), target);
+  }
+
+  // uint64 max_message_size = 3;
+  if (this->_internal_max_message_size() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(3, this->_internal_max_message_size(), target);
+  }
+
+  // bool multiplexing = 4;
+  if (this->_internal_multiplexing() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(4, this->_internal_multiplexing(), target);
+  }
+
+  // bool checksum = 5;
+  if (this->_internal_checksum() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(5, this->_internal_checksum(), target);
+  }
+
+  // repeated uint32 ambiguous_method_ids = 6;
+  {
+    int byte_size = _impl_._ambiguous_method_ids_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteUInt32Packed(
+          6, _internal_ambiguous_method_ids(), byte_size, target);
+    }
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:rpcheader.Handshake)
+  return target;
+}
+
+size_t Handshake::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:rpcheader.Handshake)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated uint32 ambiguous_method_ids = 6;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      UInt32Size(this->_impl_.ambiguous_method_ids_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._ambiguous_method_ids_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // uint32 protocol_version = 1;
+  if (this->_internal_protocol_version() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_protocol_version());
+  }
+
+  // uint32 compression = 2;
+  if (this->_internal_compression() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_compression());
+  }
+
+  // uint64 max_message_size = 3;
+  if (this->_internal_max_message_size() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_max_message_size());
+  }
+
+  // bool multiplexing = 4;
+  if (this->_internal_multiplexing() != 0) {
+    total_size += 1 + 1;
+  }
+
+  // bool checksum = 5;
+  if (this->_internal_checksum() != 0) {
+    total_size += 1 + 1;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Handshake::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Handshake::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Handshake::GetClassData() const { return &_class_data_; }
+
+
+void Handshake::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Handshake*>(&to_msg);
+  auto& from = static_cast<const Handshake&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:rpcheader.Handshake)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.ambiguous_method_ids_.MergeFrom(from._impl_.ambiguous_method_ids_);
+  if (from._internal_protocol_version() != 0) {
+    _this->_internal_set_protocol_version(from._internal_protocol_version());
+  }
+  if (from._internal_compression() != 0) {
+    _this->_internal_set_compression(from._internal_compression());
+  }
+  if (from._internal_max_message_size() != 0) {
+    _this->_internal_set_max_message_size(from._internal_max_message_size());
+  }
+  if (from._internal_multiplexing() != 0) {
+    _this->_internal_set_multiplexing(from._internal_multiplexing());
+  }
+  if (from._internal_checksum() != 0) {
+    _this->_internal_set_checksum(from._internal_checksum());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Handshake::CopyFrom(const Handshake& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:rpcheader.Handshake)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool RpcHeader::IsInitialized() const {
+bool Handshake::IsInitialized() const {
   return true;
 }
 
-void RpcHeader::Swap(RpcHeader* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
-void RpcHeader::InternalSwap(RpcHeader* other) {
+void Handshake::InternalSwap(Handshake* other) {
   using std::swap;
-  service_name_.Swap(&other->service_name_, &::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-    GetArenaNoVirtual());
-  method_name_.Swap(&other->method_name_, &::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-    GetArenaNoVirtual());
-  swap(args_size_, other->args_size_);
-  _internal_metadata_.Swap(&other->_internal_metadata_);
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.ambiguous_method_ids_.InternalSwap(&other->_impl_.ambiguous_method_ids_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Handshake, _impl_.checksum_)
+      + sizeof(Handshake::_impl_.checksum_)
+      - PROTOBUF_FIELD_OFFSET(Handshake, _impl_.protocol_version_)>(
+          reinterpret_cast<char*>(&_impl_.protocol_version_),
+          reinterpret_cast<char*>(&other->_impl_.protocol_version_));
 }
 
-::google::protobuf::Metadata RpcHeader::GetMetadata() const {
-  protobuf_rpcheader_2eproto::protobuf_AssignDescriptorsOnce();
-  return ::protobuf_rpcheader_2eproto::file_level_metadata[kIndexInFileMessages];
+::PROTOBUF_NAMESPACE_ID::Metadata Handshake::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_rpcheader_2eproto_getter, &descriptor_table_rpcheader_2eproto_once,
+      file_level_metadata_rpcheader_2eproto[2]);
 }
 
-
 // @@protoc_insertion_point(namespace_scope)
 }  // namespace rpcheader
-namespace google {
-namespace protobuf {
-template<> GOOGLE_PROTOBUF_ATTRIBUTE_NOINLINE ::rpcheader::RpcHeader* Arena::CreateMaybeMessage< ::rpcheader::RpcHeader >(Arena* arena) {
-  return Arena::CreateInternal< ::rpcheader::RpcHeader >(arena);
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::rpcheader::RpcHeader*
+Arena::CreateMaybeMessage< ::rpcheader::RpcHeader >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::rpcheader::RpcHeader >(arena);
+}
+template<> PROTOBUF_NOINLINE ::rpcheader::RpcResponseHeader*
+Arena::CreateMaybeMessage< ::rpcheader::RpcResponseHeader >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::rpcheader::RpcResponseHeader >(arena);
+}
+template<> PROTOBUF_NOINLINE ::rpcheader::Handshake*
+Arena::CreateMaybeMessage< ::rpcheader::Handshake >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::rpcheader::Handshake >(arena);
 }
-}  // namespace protobuf
-}  // namespace google
+PROTOBUF_NAMESPACE_CLOSE
 
 // @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
@@ -1,94 +1,201 @@
 // Generated by the protocol buffer compiler.  DO NOT EDIT!
 // source: rpcheader.proto
 
-#ifndef PROTOBUF_INCLUDED_rpcheader_2eproto
-#define PROTOBUF_INCLUDED_rpcheader_2eproto
+#ifndef GOOGLE_PROTOBUF_INCLUDED_rpcheader_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_rpcheader_2eproto
 
+#include <limits>
 #include <string>
 
-#include <google/protobuf/stubs/common.h>
-
-#if GOOGLE_PROTOBUF_VERSION < 3006001
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
 #error This file was generated by a newer version of protoc which is
-#error incompatible with your Protocol Buffer headers.  Please update
+#error incompatible with your Protocol Buffer headers. Please update
 #error your headers.
 #endif
-#if 3006001 < GOOGLE_PROTOBUF_MIN_PROTOC_VERSION
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
 #error This file was generated by an older version of protoc which is
-#error incompatible with your Protocol Buffer headers.  Please
+#error incompatible with your Protocol Buffer headers. Please
 #error regenerate this file with a newer version of protoc.
 #endif
 
+#include <google/protobuf/port_undef.inc>
 #include <google/protobuf/io/coded_stream.h>
 #include <google/protobuf/arena.h>
 #include <google/protobuf/arenastring.h>
-#include <google/protobuf/generated_message_table_driven.h>
 #include <google/protobuf/generated_message_util.h>
-#include <google/protobuf/inlined_string_field.h>
-#include <google/protobuf/metadata.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
 #include <google/protobuf/message.h>
 #include <google/protobuf/repeated_field.h>  // IWYU pragma: export
 #include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/generated_enum_reflection.h>
 #include <google/protobuf/unknown_field_set.h>
 // @@protoc_insertion_point(includes)
-#define PROTOBUF_INTERNAL_EXPORT_protobuf_rpcheader_2eproto 
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_rpcheader_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
 
-namespace protobuf_rpcheader_2eproto {
 // Internal implementation detail -- do not use these members.
-struct TableStruct {
-  static const ::google::protobuf::internal::ParseTableField entries[];
-  static const ::google::protobuf::internal::AuxillaryParseTableField aux[];
-  static const ::google::protobuf::internal::ParseTable schema[1];
-  static const ::google::protobuf::internal::FieldMetadata field_metadata[];
-  static const ::google::protobuf::internal::SerializationTable serialization_table[];
-  static const ::google::protobuf::uint32 offsets[];
+struct TableStruct_rpcheader_2eproto {
+  static const uint32_t offsets[];
 };
-void AddDescriptors();
-}  // namespace protobuf_rpcheader_2eproto
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_rpcheader_2eproto;
 namespace rpcheader {
+class Handshake;
+struct HandshakeDefaultTypeInternal;
+extern HandshakeDefaultTypeInternal _Handshake_default_instance_;
 class RpcHeader;
-class RpcHeaderDefaultTypeInternal;
+struct RpcHeaderDefaultTypeInternal;
 extern RpcHeaderDefaultTypeInternal _RpcHeader_default_instance_;
+class RpcResponseHeader;
+struct RpcResponseHeaderDefaultTypeInternal;
+extern RpcResponseHeaderDefaultTypeInternal _RpcResponseHeader_default_instance_;
 }  // namespace rpcheader
-namespace google {
-namespace protobuf {
+PROTOBUF_NAMESPACE_OPEN
+template<> ::rpcheader::Handshake* Arena::CreateMaybeMessage<::rpcheader::Handshake>(Arena*);
 template<> ::rpcheader::RpcHeader* Arena::CreateMaybeMessage<::rpcheader::RpcHeader>(Arena*);
-}  // namespace protobuf
-}  // namespace google
+template<> ::rpcheader::RpcResponseHeader* Arena::CreateMaybeMessage<::rpcheader::RpcResponseHeader>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
 namespace rpcheader {
 
+enum FrameType : int {
+  FRAME_UNARY = 0,
+  FRAME_STREAM_MESSAGE = 1,
+  FRAME_STREAM_CREDIT = 2,
+  FRAME_STREAM_END = 3,
+  FRAME_CHUNK = 4,
+  FRAME_HANDSHAKE = 5,
+  FRAME_STREAM_RESET = 6,
+  FrameType_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  FrameType_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
+};
+bool FrameType_IsValid(int value);
+constexpr FrameType FrameType_MIN = FRAME_UNARY;
+constexpr FrameType FrameType_MAX = FRAME_STREAM_RESET;
+constexpr int FrameType_ARRAYSIZE = FrameType_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* FrameType_descriptor();
+template<typename T>
+inline const std::string& FrameType_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, FrameType>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function FrameType_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    FrameType_descriptor(), enum_t_value);
+}
+inline bool FrameType_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, FrameType* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<FrameType>(
+    FrameType_descriptor(), name, value);
+}
+enum CompressionType : int {
+  COMPRESS_NONE = 0,
+  COMPRESS_LZ4 = 1,
+  COMPRESS_ZSTD = 2,
+  COMPRESS_ZLIB = 3,
+  CompressionType_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  CompressionType_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
+};
+bool CompressionType_IsValid(int value);
+constexpr CompressionType CompressionType_MIN = COMPRESS_NONE;
+constexpr CompressionType CompressionType_MAX = COMPRESS_ZLIB;
+constexpr int CompressionType_ARRAYSIZE = CompressionType_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* CompressionType_descriptor();
+template<typename T>
+inline const std::string& CompressionType_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, CompressionType>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function CompressionType_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    CompressionType_descriptor(), enum_t_value);
+}
+inline bool CompressionType_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, CompressionType* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<CompressionType>(
+    CompressionType_descriptor(), name, value);
+}
+enum RpcStatus : int {
+  RPC_OK = 0,
+  RPC_SERVER_BUSY = 1,
+  RPC_OVERLOADED = 2,
+  RPC_SERVICE_NOT_FOUND = 3,
+  RPC_METHOD_NOT_FOUND = 4,
+  RPC_BAD_REQUEST = 5,
+  RPC_METHOD_FAILED = 6,
+  RPC_DEADLINE_EXCEEDED = 7,
+  RpcStatus_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  RpcStatus_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
+};
+bool RpcStatus_IsValid(int value);
+constexpr RpcStatus RpcStatus_MIN = RPC_OK;
+constexpr RpcStatus RpcStatus_MAX = RPC_DEADLINE_EXCEEDED;
+constexpr int RpcStatus_ARRAYSIZE = RpcStatus_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* RpcStatus_descriptor();
+template<typename T>
+inline const std::string& RpcStatus_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, RpcStatus>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function RpcStatus_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    RpcStatus_descriptor(), enum_t_value);
+}
+inline bool RpcStatus_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, RpcStatus* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<RpcStatus>(
+    RpcStatus_descriptor(), name, value);
+}
 // ===================================================================
 
-class RpcHeader : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:rpcheader.RpcHeader) */ {
+class RpcHeader final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:rpcheader.RpcHeader) */ {
  public:
-  RpcHeader();
-  virtual ~RpcHeader();
+  inline RpcHeader() : RpcHeader(nullptr) {}
+  ~RpcHeader() override;
+  explicit PROTOBUF_CONSTEXPR RpcHeader(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   RpcHeader(const RpcHeader& from);
-
-  inline RpcHeader& operator=(const RpcHeader& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  #if LANG_CXX11
   RpcHeader(RpcHeader&& from) noexcept
     : RpcHeader() {
     *this = ::std::move(from);
   }
 
+  inline RpcHeader& operator=(const RpcHeader& from) {
+    CopyFrom(from);
+    return *this;
+  }
   inline RpcHeader& operator=(RpcHeader&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
     return *this;
   }
-  #endif
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const RpcHeader& default_instance();
 
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const RpcHeader& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const RpcHeader* internal_default_instance() {
     return reinterpret_cast<const RpcHeader*>(
                &_RpcHeader_default_instance_);
@@ -96,99 +203,749 @@ class RpcHeader : public ::google::protobuf::Message /* @@protoc_insertion_point
   static constexpr int kIndexInFileMessages =
     0;
 
-  void Swap(RpcHeader* other);
   friend void swap(RpcHeader& a, RpcHeader& b) {
     a.Swap(&b);
   }
+  inline void Swap(RpcHeader* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(RpcHeader* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline RpcHeader* New() const final {
-    return CreateMaybeMessage<RpcHeader>(NULL);
-  }
-
-  RpcHeader* New(::google::protobuf::Arena* arena) const final {
+  RpcHeader* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<RpcHeader>(arena);
   }
-  void CopyFrom(const ::google::protobuf::Message& from) final;
-  void MergeFrom(const ::google::protobuf::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const RpcHeader& from);
-  void MergeFrom(const RpcHeader& from);
-  void Clear() final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const RpcHeader& from) {
+    RpcHeader::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) final;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const final;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(RpcHeader* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "rpcheader.RpcHeader";
   }
+  protected:
+  explicit RpcHeader(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const final;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kServiceNameFieldNumber = 1,
+    kMethodNameFieldNumber = 2,
+    kTenantFieldNumber = 5,
+    kMetadataFieldNumber = 16,
+    kRequestIdFieldNumber = 4,
+    kArgsSizeFieldNumber = 3,
+    kBatchCountFieldNumber = 6,
+    kOneWayFieldNumber = 7,
+    kFrameTypeFieldNumber = 8,
+    kCreditFieldNumber = 9,
+    kCompressionFieldNumber = 10,
+    kUncompressedSizeFieldNumber = 11,
+    kMethodIdFieldNumber = 13,
+    kTimeoutMsFieldNumber = 14,
+    kMethodIndexFieldNumber = 15,
+  };
   // bytes service_name = 1;
   void clear_service_name();
-  static const int kServiceNameFieldNumber = 1;
-  const ::std::string& service_name() const;
-  void set_service_name(const ::std::string& value);
-  #if LANG_CXX11
-  void set_service_name(::std::string&& value);
-  #endif
-  void set_service_name(const char* value);
-  void set_service_name(const void* value, size_t size);
-  ::std::string* mutable_service_name();
-  ::std::string* release_service_name();
-  void set_allocated_service_name(::std::string* service_name);
+  const std::string& service_name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_service_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_service_name();
+  PROTOBUF_NODISCARD std::string* release_service_name();
+  void set_allocated_service_name(std::string* service_name);
+  private:
+  const std::string& _internal_service_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_service_name(const std::string& value);
+  std::string* _internal_mutable_service_name();
+  public:
 
   // bytes method_name = 2;
   void clear_method_name();
-  static const int kMethodNameFieldNumber = 2;
-  const ::std::string& method_name() const;
-  void set_method_name(const ::std::string& value);
-  #if LANG_CXX11
-  void set_method_name(::std::string&& value);
-  #endif
-  void set_method_name(const char* value);
-  void set_method_name(const void* value, size_t size);
-  ::std::string* mutable_method_name();
-  ::std::string* release_method_name();
-  void set_allocated_method_name(::std::string* method_name);
+  const std::string& method_name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_method_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_method_name();
+  PROTOBUF_NODISCARD std::string* release_method_name();
+  void set_allocated_method_name(std::string* method_name);
+  private:
+  const std::string& _internal_method_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_method_name(const std::string& value);
+  std::string* _internal_mutable_method_name();
+  public:
+
+  // bytes tenant = 5;
+  void clear_tenant();
+  const std::string& tenant() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_tenant(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_tenant();
+  PROTOBUF_NODISCARD std::string* release_tenant();
+  void set_allocated_tenant(std::string* tenant);
+  private:
+  const std::string& _internal_tenant() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_tenant(const std::string& value);
+  std::string* _internal_mutable_tenant();
+  public:
+
+  // bytes metadata = 16;
+  void clear_metadata();
+  const std::string& metadata() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_metadata(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_metadata();
+  PROTOBUF_NODISCARD std::string* release_metadata();
+  void set_allocated_metadata(std::string* metadata);
+  private:
+  const std::string& _internal_metadata() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_metadata(const std::string& value);
+  std::string* _internal_mutable_metadata();
+  public:
+
+  // uint64 request_id = 4;
+  void clear_request_id();
+  uint64_t request_id() const;
+  void set_request_id(uint64_t value);
+  private:
+  uint64_t _internal_request_id() const;
+  void _internal_set_request_id(uint64_t value);
+  public:
 
   // uint32 args_size = 3;
   void clear_args_size();
-  static const int kArgsSizeFieldNumber = 3;
-  ::google::protobuf::uint32 args_size() const;
-  void set_args_size(::google::protobuf::uint32 value);
+  uint32_t args_size() const;
+  void set_args_size(uint32_t value);
+  private:
+  uint32_t _internal_args_size() const;
+  void _internal_set_args_size(uint32_t value);
+  public:
+
+  // uint32 batch_count = 6;
+  void clear_batch_count();
+  uint32_t batch_count() const;
+  void set_batch_count(uint32_t value);
+  private:
+  uint32_t _internal_batch_count() const;
+  void _internal_set_batch_count(uint32_t value);
+  public:
+
+  // bool one_way = 7;
+  void clear_one_way();
+  bool one_way() const;
+  void set_one_way(bool value);
+  private:
+  bool _internal_one_way() const;
+  void _internal_set_one_way(bool value);
+  public:
+
+  // .rpcheader.FrameType frame_type = 8;
+  void clear_frame_type();
+  ::rpcheader::FrameType frame_type() const;
+  void set_frame_type(::rpcheader::FrameType value);
+  private:
+  ::rpcheader::FrameType _internal_frame_type() const;
+  void _internal_set_frame_type(::rpcheader::FrameType value);
+  public:
+
+  // uint32 credit = 9;
+  void clear_credit();
+  uint32_t credit() const;
+  void set_credit(uint32_t value);
+  private:
+  uint32_t _internal_credit() const;
+  void _internal_set_credit(uint32_t value);
+  public:
+
+  // .rpcheader.CompressionType compression = 10;
+  void clear_compression();
+  ::rpcheader::CompressionType compression() const;
+  void set_compression(::rpcheader::CompressionType value);
+  private:
+  ::rpcheader::CompressionType _internal_compression() const;
+  void _internal_set_compression(::rpcheader::CompressionType value);
+  public:
+
+  // uint32 uncompressed_size = 11;
+  void clear_uncompressed_size();
+  uint32_t uncompressed_size() const;
+  void set_uncompressed_size(uint32_t value);
+  private:
+  uint32_t _internal_uncompressed_size() const;
+  void _internal_set_uncompressed_size(uint32_t value);
+  public:
+
+  // uint32 method_id = 13;
+  void clear_method_id();
+  uint32_t method_id() const;
+  void set_method_id(uint32_t value);
+  private:
+  uint32_t _internal_method_id() const;
+  void _internal_set_method_id(uint32_t value);
+  public:
+
+  // uint32 timeout_ms = 14;
+  void clear_timeout_ms();
+  uint32_t timeout_ms() const;
+  void set_timeout_ms(uint32_t value);
+  private:
+  uint32_t _internal_timeout_ms() const;
+  void _internal_set_timeout_ms(uint32_t value);
+  public:
+
+  // uint32 method_index = 15;
+  void clear_method_index();
+  uint32_t method_index() const;
+  void set_method_index(uint32_t value);
+  private:
+  uint32_t _internal_method_index() const;
+  void _internal_set_method_index(uint32_t value);
+  public:
 
   // @@protoc_insertion_point(class_scope:rpcheader.RpcHeader)
  private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr service_name_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr method_name_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr tenant_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr metadata_;
+    uint64_t request_id_;
+    uint32_t args_size_;
+    uint32_t batch_count_;
+    bool one_way_;
+    int frame_type_;
+    uint32_t credit_;
+    int compression_;
+    uint32_t uncompressed_size_;
+    uint32_t method_id_;
+    uint32_t timeout_ms_;
+    uint32_t method_index_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_rpcheader_2eproto;
+};
+// -------------------------------------------------------------------
+
+class RpcResponseHeader final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:rpcheader.RpcResponseHeader) */ {
+ public:
+  inline RpcResponseHeader() : RpcResponseHeader(nullptr) {}
+  ~RpcResponseHeader() override;
+  explicit PROTOBUF_CONSTEXPR RpcResponseHeader(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  RpcResponseHeader(const RpcResponseHeader& from);
+  RpcResponseHeader(RpcResponseHeader&& from) noexcept
+    : RpcResponseHeader() {
+    *this = ::std::move(from);
+  }
+
+  inline RpcResponseHeader& operator=(const RpcResponseHeader& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline RpcResponseHeader& operator=(RpcResponseHeader&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const RpcResponseHeader& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const RpcResponseHeader* internal_default_instance() {
+    return reinterpret_cast<const RpcResponseHeader*>(
+               &_RpcResponseHeader_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
+
+  friend void swap(RpcResponseHeader& a, RpcResponseHeader& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(RpcResponseHeader* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(RpcResponseHeader* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  RpcResponseHeader* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<RpcResponseHeader>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const RpcResponseHeader& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const RpcResponseHeader& from) {
+    RpcResponseHeader::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(RpcResponseHeader* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "rpcheader.RpcResponseHeader";
+  }
+  protected:
+  explicit RpcResponseHeader(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kErrorTextFieldNumber = 2,
+    kMetadataFieldNumber = 12,
+    kStatusFieldNumber = 1,
+    kBodySizeFieldNumber = 3,
+    kRequestIdFieldNumber = 4,
+    kBatchCountFieldNumber = 5,
+    kFrameTypeFieldNumber = 6,
+    kCreditFieldNumber = 7,
+    kCompressionFieldNumber = 8,
+    kUncompressedSizeFieldNumber = 9,
+  };
+  // bytes error_text = 2;
+  void clear_error_text();
+  const std::string& error_text() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_error_text(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_error_text();
+  PROTOBUF_NODISCARD std::string* release_error_text();
+  void set_allocated_error_text(std::string* error_text);
+  private:
+  const std::string& _internal_error_text() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_error_text(const std::string& value);
+  std::string* _internal_mutable_error_text();
+  public:
+
+  // bytes metadata = 12;
+  void clear_metadata();
+  const std::string& metadata() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_metadata(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_metadata();
+  PROTOBUF_NODISCARD std::string* release_metadata();
+  void set_allocated_metadata(std::string* metadata);
+  private:
+  const std::string& _internal_metadata() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_metadata(const std::string& value);
+  std::string* _internal_mutable_metadata();
+  public:
+
+  // .rpcheader.RpcStatus status = 1;
+  void clear_status();
+  ::rpcheader::RpcStatus status() const;
+  void set_status(::rpcheader::RpcStatus value);
+  private:
+  ::rpcheader::RpcStatus _internal_status() const;
+  void _internal_set_status(::rpcheader::RpcStatus value);
+  public:
+
+  // uint32 body_size = 3;
+  void clear_body_size();
+  uint32_t body_size() const;
+  void set_body_size(uint32_t value);
+  private:
+  uint32_t _internal_body_size() const;
+  void _internal_set_body_size(uint32_t value);
+  public:
+
+  // uint64 request_id = 4;
+  void clear_request_id();
+  uint64_t request_id() const;
+  void set_request_id(uint64_t value);
+  private:
+  uint64_t _internal_request_id() const;
+  void _internal_set_request_id(uint64_t value);
+  public:
+
+  // uint32 batch_count = 5;
+  void clear_batch_count();
+  uint32_t batch_count() const;
+  void set_batch_count(uint32_t value);
+  private:
+  uint32_t _internal_batch_count() const;
+  void _internal_set_batch_count(uint32_t value);
+  public:
+
+  // .rpcheader.FrameType frame_type = 6;
+  void clear_frame_type();
+  ::rpcheader::FrameType frame_type() const;
+  void set_frame_type(::rpcheader::FrameType value);
+  private:
+  ::rpcheader::FrameType _internal_frame_type() const;
+  void _internal_set_frame_type(::rpcheader::FrameType value);
+  public:
+
+  // uint32 credit = 7;
+  void clear_credit();
+  uint32_t credit() const;
+  void set_credit(uint32_t value);
+  private:
+  uint32_t _internal_credit() const;
+  void _internal_set_credit(uint32_t value);
+  public:
+
+  // .rpcheader.CompressionType compression = 8;
+  void clear_compression();
+  ::rpcheader::CompressionType compression() const;
+  void set_compression(::rpcheader::CompressionType value);
+  private:
+  ::rpcheader::CompressionType _internal_compression() const;
+  void _internal_set_compression(::rpcheader::CompressionType value);
+  public:
+
+  // uint32 uncompressed_size = 9;
+  void clear_uncompressed_size();
+  uint32_t uncompressed_size() const;
+  void set_uncompressed_size(uint32_t value);
+  private:
+  uint32_t _internal_uncompressed_size() const;
+  void _internal_set_uncompressed_size(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:rpcheader.RpcResponseHeader)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr error_text_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr metadata_;
+    int status_;
+    uint32_t body_size_;
+    uint64_t request_id_;
+    uint32_t batch_count_;
+    int frame_type_;
+    uint32_t credit_;
+    int compression_;
+    uint32_t uncompressed_size_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_rpcheader_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Handshake final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:rpcheader.Handshake) */ {
+ public:
+  inline Handshake() : Handshake(nullptr) {}
+  ~Handshake() override;
+  explicit PROTOBUF_CONSTEXPR Handshake(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Handshake(const Handshake& from);
+  Handshake(Handshake&& from) noexcept
+    : Handshake() {
+    *this = ::std::move(from);
+  }
+
+  inline Handshake& operator=(const Handshake& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Handshake& operator=(Handshake&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Handshake& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Handshake* internal_default_instance() {
+    return reinterpret_cast<const Handshake*>(
+               &_Handshake_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    2;
+
+  friend void swap(Handshake& a, Handshake& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Handshake* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Handshake* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Handshake* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Handshake>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Handshake& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Handshake& from) {
+    Handshake::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Handshake* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "rpcheader.Handshake";
+  }
+  protected:
+  explicit Handshake(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kAmbiguousMethodIdsFieldNumber = 6,
+    kProtocolVersionFieldNumber = 1,
+    kCompressionFieldNumber = 2,
+    kMaxMessageSizeFieldNumber = 3,
+    kMultiplexingFieldNumber = 4,
+    kChecksumFieldNumber = 5,
+  };
+  // repeated uint32 ambiguous_method_ids = 6;
+  int ambiguous_method_ids_size() const;
+  private:
+  int _internal_ambiguous_method_ids_size() const;
+  public:
+  void clear_ambiguous_method_ids();
+  private:
+  uint32_t _internal_ambiguous_method_ids(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      _internal_ambiguous_method_ids() const;
+  void _internal_add_ambiguous_method_ids(uint32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      _internal_mutable_ambiguous_method_ids();
+  public:
+  uint32_t ambiguous_method_ids(int index) const;
+  void set_ambiguous_method_ids(int index, uint32_t value);
+  void add_ambiguous_method_ids(uint32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      ambiguous_method_ids() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      mutable_ambiguous_method_ids();
+
+  // uint32 protocol_version = 1;
+  void clear_protocol_version();
+  uint32_t protocol_version() const;
+  void set_protocol_version(uint32_t value);
+  private:
+  uint32_t _internal_protocol_version() const;
+  void _internal_set_protocol_version(uint32_t value);
+  public:
+
+  // uint32 compression = 2;
+  void clear_compression();
+  uint32_t compression() const;
+  void set_compression(uint32_t value);
+  private:
+  uint32_t _internal_compression() const;
+  void _internal_set_compression(uint32_t value);
+  public:
+
+  // uint64 max_message_size = 3;
+  void clear_max_message_size();
+  uint64_t max_message_size() const;
+  void set_max_message_size(uint64_t value);
+  private:
+  uint64_t _internal_max_message_size() const;
+  void _internal_set_max_message_size(uint64_t value);
+  public:
+
+  // bool multiplexing = 4;
+  void clear_multiplexing();
+  bool multiplexing() const;
+  void set_multiplexing(bool value);
+  private:
+  bool _internal_multiplexing() const;
+  void _internal_set_multiplexing(bool value);
+  public:
+
+  // bool checksum = 5;
+  void clear_checksum();
+  bool checksum() const;
+  void set_checksum(bool value);
+  private:
+  bool _internal_checksum() const;
+  void _internal_set_checksum(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:rpcheader.Handshake)
+ private:
+  class _Internal;
 
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::google::protobuf::internal::ArenaStringPtr service_name_;
-  ::google::protobuf::internal::ArenaStringPtr method_name_;
-  ::google::protobuf::uint32 args_size_;
-  mutable ::google::protobuf::internal::CachedSize _cached_size_;
-  friend struct ::protobuf_rpcheader_2eproto::TableStruct;
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t > ambiguous_method_ids_;
+    mutable std::atomic<int> _ambiguous_method_ids_cached_byte_size_;
+    uint32_t protocol_version_;
+    uint32_t compression_;
+    uint64_t max_message_size_;
+    bool multiplexing_;
+    bool checksum_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_rpcheader_2eproto;
 };
 // ===================================================================
 
@@ -203,132 +960,872 @@ class RpcHeader : public ::google::protobuf::Message /* @@protoc_insertion_point
 
 // bytes service_name = 1;
 inline void RpcHeader::clear_service_name() {
-  service_name_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.service_name_.ClearToEmpty();
 }
-inline const ::std::string& RpcHeader::service_name() const {
+inline const std::string& RpcHeader::service_name() const {
   // @@protoc_insertion_point(field_get:rpcheader.RpcHeader.service_name)
-  return service_name_.GetNoArena();
+  return _internal_service_name();
 }
-inline void RpcHeader::set_service_name(const ::std::string& value) {
-  
-  service_name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void RpcHeader::set_service_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.service_name_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:rpcheader.RpcHeader.service_name)
 }
-#if LANG_CXX11
-inline void RpcHeader::set_service_name(::std::string&& value) {
-  
-  service_name_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:rpcheader.RpcHeader.service_name)
+inline std::string* RpcHeader::mutable_service_name() {
+  std::string* _s = _internal_mutable_service_name();
+  // @@protoc_insertion_point(field_mutable:rpcheader.RpcHeader.service_name)
+  return _s;
 }
-#endif
-inline void RpcHeader::set_service_name(const char* value) {
-  GOOGLE_DCHECK(value != NULL);
-  
-  service_name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:rpcheader.RpcHeader.service_name)
+inline const std::string& RpcHeader::_internal_service_name() const {
+  return _impl_.service_name_.Get();
 }
-inline void RpcHeader::set_service_name(const void* value, size_t size) {
+inline void RpcHeader::_internal_set_service_name(const std::string& value) {
   
-  service_name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:rpcheader.RpcHeader.service_name)
+  _impl_.service_name_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* RpcHeader::mutable_service_name() {
+inline std::string* RpcHeader::_internal_mutable_service_name() {
   
-  // @@protoc_insertion_point(field_mutable:rpcheader.RpcHeader.service_name)
-  return service_name_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.service_name_.Mutable(GetArenaForAllocation());
 }
-inline ::std::string* RpcHeader::release_service_name() {
+inline std::string* RpcHeader::release_service_name() {
   // @@protoc_insertion_point(field_release:rpcheader.RpcHeader.service_name)
-  
-  return service_name_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.service_name_.Release();
 }
-inline void RpcHeader::set_allocated_service_name(::std::string* service_name) {
-  if (service_name != NULL) {
+inline void RpcHeader::set_allocated_service_name(std::string* service_name) {
+  if (service_name != nullptr) {
     
   } else {
     
   }
-  service_name_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), service_name);
+  _impl_.service_name_.SetAllocated(service_name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.service_name_.IsDefault()) {
+    _impl_.service_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:rpcheader.RpcHeader.service_name)
 }
 
 // bytes method_name = 2;
 inline void RpcHeader::clear_method_name() {
-  method_name_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.method_name_.ClearToEmpty();
 }
-inline const ::std::string& RpcHeader::method_name() const {
+inline const std::string& RpcHeader::method_name() const {
   // @@protoc_insertion_point(field_get:rpcheader.RpcHeader.method_name)
-  return method_name_.GetNoArena();
+  return _internal_method_name();
 }
-inline void RpcHeader::set_method_name(const ::std::string& value) {
-  
-  method_name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void RpcHeader::set_method_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.method_name_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:rpcheader.RpcHeader.method_name)
 }
-#if LANG_CXX11
-inline void RpcHeader::set_method_name(::std::string&& value) {
-  
-  method_name_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:rpcheader.RpcHeader.method_name)
+inline std::string* RpcHeader::mutable_method_name() {
+  std::string* _s = _internal_mutable_method_name();
+  // @@protoc_insertion_point(field_mutable:rpcheader.RpcHeader.method_name)
+  return _s;
 }
-#endif
-inline void RpcHeader::set_method_name(const char* value) {
-  GOOGLE_DCHECK(value != NULL);
-  
-  method_name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:rpcheader.RpcHeader.method_name)
+inline const std::string& RpcHeader::_internal_method_name() const {
+  return _impl_.method_name_.Get();
 }
-inline void RpcHeader::set_method_name(const void* value, size_t size) {
+inline void RpcHeader::_internal_set_method_name(const std::string& value) {
   
-  method_name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:rpcheader.RpcHeader.method_name)
+  _impl_.method_name_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* RpcHeader::mutable_method_name() {
+inline std::string* RpcHeader::_internal_mutable_method_name() {
   
-  // @@protoc_insertion_point(field_mutable:rpcheader.RpcHeader.method_name)
-  return method_name_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.method_name_.Mutable(GetArenaForAllocation());
 }
-inline ::std::string* RpcHeader::release_method_name() {
+inline std::string* RpcHeader::release_method_name() {
   // @@protoc_insertion_point(field_release:rpcheader.RpcHeader.method_name)
-  
-  return method_name_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.method_name_.Release();
 }
-inline void RpcHeader::set_allocated_method_name(::std::string* method_name) {
-  if (method_name != NULL) {
+inline void RpcHeader::set_allocated_method_name(std::string* method_name) {
+  if (method_name != nullptr) {
     
   } else {
     
   }
-  method_name_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), method_name);
+  _impl_.method_name_.SetAllocated(method_name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.method_name_.IsDefault()) {
+    _impl_.method_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:rpcheader.RpcHeader.method_name)
 }
 
 // uint32 args_size = 3;
 inline void RpcHeader::clear_args_size() {
-  args_size_ = 0u;
+  _impl_.args_size_ = 0u;
+}
+inline uint32_t RpcHeader::_internal_args_size() const {
+  return _impl_.args_size_;
 }
-inline ::google::protobuf::uint32 RpcHeader::args_size() const {
+inline uint32_t RpcHeader::args_size() const {
   // @@protoc_insertion_point(field_get:rpcheader.RpcHeader.args_size)
-  return args_size_;
+  return _internal_args_size();
 }
-inline void RpcHeader::set_args_size(::google::protobuf::uint32 value) {
+inline void RpcHeader::_internal_set_args_size(uint32_t value) {
   
-  args_size_ = value;
+  _impl_.args_size_ = value;
+}
+inline void RpcHeader::set_args_size(uint32_t value) {
+  _internal_set_args_size(value);
   // @@protoc_insertion_point(field_set:rpcheader.RpcHeader.args_size)
 }
 
+// uint64 request_id = 4;
+inline void RpcHeader::clear_request_id() {
+  _impl_.request_id_ = uint64_t{0u};
+}
+inline uint64_t RpcHeader::_internal_request_id() const {
+  return _impl_.request_id_;
+}
+inline uint64_t RpcHeader::request_id() const {
+  // @@protoc_insertion_point(field_get:rpcheader.RpcHeader.request_id)
+  return _internal_request_id();
+}
+inline void RpcHeader::_internal_set_request_id(uint64_t value) {
+  
+  _impl_.request_id_ = value;
+}
+inline void RpcHeader::set_request_id(uint64_t value) {
+  _internal_set_request_id(value);
+  // @@protoc_insertion_point(field_set:rpcheader.RpcHeader.request_id)
+}
+
+// bytes tenant = 5;
+inline void RpcHeader::clear_tenant() {
+  _impl_.tenant_.ClearToEmpty();
+}
+inline const std::string& RpcHeader::tenant() const {
+  // @@protoc_insertion_point(field_get:rpcheader.RpcHeader.tenant)
+  return _internal_tenant();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void RpcHeader::set_tenant(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.tenant_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:rpcheader.RpcHeader.tenant)
+}
+inline std::string* RpcHeader::mutable_tenant() {
+  std::string* _s = _internal_mutable_tenant();
+  // @@protoc_insertion_point(field_mutable:rpcheader.RpcHeader.tenant)
+  return _s;
+}
+inline const std::string& RpcHeader::_internal_tenant() const {
+  return _impl_.tenant_.Get();
+}
+inline void RpcHeader::_internal_set_tenant(const std::string& value) {
+  
+  _impl_.tenant_.Set(value, GetArenaForAllocation());
+}
+inline std::string* RpcHeader::_internal_mutable_tenant() {
+  
+  return _impl_.tenant_.Mutable(GetArenaForAllocation());
+}
+inline std::string* RpcHeader::release_tenant() {
+  // @@protoc_insertion_point(field_release:rpcheader.RpcHeader.tenant)
+  return _impl_.tenant_.Release();
+}
+inline void RpcHeader::set_allocated_tenant(std::string* tenant) {
+  if (tenant != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.tenant_.SetAllocated(tenant, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.tenant_.IsDefault()) {
+    _impl_.tenant_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:rpcheader.RpcHeader.tenant)
+}
+
+// uint32 batch_count = 6;
+inline void RpcHeader::clear_batch_count() {
+  _impl_.batch_count_ = 0u;
+}
+inline uint32_t RpcHeader::_internal_batch_count() const {
+  return _impl_.batch_count_;
+}
+inline uint32_t RpcHeader::batch_count() const {
+  // @@protoc_insertion_point(field_get:rpcheader.RpcHeader.batch_count)
+  return _internal_batch_count();
+}
+inline void RpcHeader::_internal_set_batch_count(uint32_t value) {
+  
+  _impl_.batch_count_ = value;
+}
+inline void RpcHeader::set_batch_count(uint32_t value) {
+  _internal_set_batch_count(value);
+  // @@protoc_insertion_point(field_set:rpcheader.RpcHeader.batch_count)
+}
+
+// bool one_way = 7;
+inline void RpcHeader::clear_one_way() {
+  _impl_.one_way_ = false;
+}
+inline bool RpcHeader::_internal_one_way() const {
+  return _impl_.one_way_;
+}
+inline bool RpcHeader::one_way() const {
+  // @@protoc_insertion_point(field_get:rpcheader.RpcHeader.one_way)
+  return _internal_one_way();
+}
+inline void RpcHeader::_internal_set_one_way(bool value) {
+  
+  _impl_.one_way_ = value;
+}
+inline void RpcHeader::set_one_way(bool value) {
+  _internal_set_one_way(value);
+  // @@protoc_insertion_point(field_set:rpcheader.RpcHeader.one_way)
+}
+
+// .rpcheader.FrameType frame_type = 8;
+inline void RpcHeader::clear_frame_type() {
+  _impl_.frame_type_ = 0;
+}
+inline ::rpcheader::FrameType RpcHeader::_internal_frame_type() const {
+  return static_cast< ::rpcheader::FrameType >(_impl_.frame_type_);
+}
+inline ::rpcheader::FrameType RpcHeader::frame_type() const {
+  // @@protoc_insertion_point(field_get:rpcheader.RpcHeader.frame_type)
+  return _internal_frame_type();
+}
+inline void RpcHeader::_internal_set_frame_type(::rpcheader::FrameType value) {
+  
+  _impl_.frame_type_ = value;
+}
+inline void RpcHeader::set_frame_type(::rpcheader::FrameType value) {
+  _internal_set_frame_type(value);
+  // @@protoc_insertion_point(field_set:rpcheader.RpcHeader.frame_type)
+}
+
+// uint32 credit = 9;
+inline void RpcHeader::clear_credit() {
+  _impl_.credit_ = 0u;
+}
+inline uint32_t RpcHeader::_internal_credit() const {
+  return _impl_.credit_;
+}
+inline uint32_t RpcHeader::credit() const {
+  // @@protoc_insertion_point(field_get:rpcheader.RpcHeader.credit)
+  return _internal_credit();
+}
+inline void RpcHeader::_internal_set_credit(uint32_t value) {
+  
+  _impl_.credit_ = value;
+}
+inline void RpcHeader::set_credit(uint32_t value) {
+  _internal_set_credit(value);
+  // @@protoc_insertion_point(field_set:rpcheader.RpcHeader.credit)
+}
+
+// .rpcheader.CompressionType compression = 10;
+inline void RpcHeader::clear_compression() {
+  _impl_.compression_ = 0;
+}
+inline ::rpcheader::CompressionType RpcHeader::_internal_compression() const {
+  return static_cast< ::rpcheader::CompressionType >(_impl_.compression_);
+}
+inline ::rpcheader::CompressionType RpcHeader::compression() const {
+  // @@protoc_insertion_point(field_get:rpcheader.RpcHeader.compression)
+  return _internal_compression();
+}
+inline void RpcHeader::_internal_set_compression(::rpcheader::CompressionType value) {
+  
+  _impl_.compression_ = value;
+}
+inline void RpcHeader::set_compression(::rpcheader::CompressionType value) {
+  _internal_set_compression(value);
+  // @@protoc_insertion_point(field_set:rpcheader.RpcHeader.compression)
+}
+
+// uint32 uncompressed_size = 11;
+inline void RpcHeader::clear_uncompressed_size() {
+  _impl_.uncompressed_size_ = 0u;
+}
+inline uint32_t RpcHeader::_internal_uncompressed_size() const {
+  return _impl_.uncompressed_size_;
+}
+inline uint32_t RpcHeader::uncompressed_size() const {
+  // @@protoc_insertion_point(field_get:rpcheader.RpcHeader.uncompressed_size)
+  return _internal_uncompressed_size();
+}
+inline void RpcHeader::_internal_set_uncompressed_size(uint32_t value) {
+  
+  _impl_.uncompressed_size_ = value;
+}
+inline void RpcHeader::set_uncompressed_size(uint32_t value) {
+  _internal_set_uncompressed_size(value);
+  // @@protoc_insertion_point(field_set:rpcheader.RpcHeader.uncompressed_size)
+}
+
+// uint32 method_id = 13;
+inline void RpcHeader::clear_method_id() {
+  _impl_.method_id_ = 0u;
+}
+inline uint32_t RpcHeader::_internal_method_id() const {
+  return _impl_.method_id_;
+}
+inline uint32_t RpcHeader::method_id() const {
+  // @@protoc_insertion_point(field_get:rpcheader.RpcHeader.method_id)
+  return _internal_method_id();
+}
+inline void RpcHeader::_internal_set_method_id(uint32_t value) {
+  
+  _impl_.method_id_ = value;
+}
+inline void RpcHeader::set_method_id(uint32_t value) {
+  _internal_set_method_id(value);
+  // @@protoc_insertion_point(field_set:rpcheader.RpcHeader.method_id)
+}
+
+// uint32 timeout_ms = 14;
+inline void RpcHeader::clear_timeout_ms() {
+  _impl_.timeout_ms_ = 0u;
+}
+inline uint32_t RpcHeader::_internal_timeout_ms() const {
+  return _impl_.timeout_ms_;
+}
+inline uint32_t RpcHeader::timeout_ms() const {
+  // @@protoc_insertion_point(field_get:rpcheader.RpcHeader.timeout_ms)
+  return _internal_timeout_ms();
+}
+inline void RpcHeader::_internal_set_timeout_ms(uint32_t value) {
+  
+  _impl_.timeout_ms_ = value;
+}
+inline void RpcHeader::set_timeout_ms(uint32_t value) {
+  _internal_set_timeout_ms(value);
+  // @@protoc_insertion_point(field_set:rpcheader.RpcHeader.timeout_ms)
+}
+
+// uint32 method_index = 15;
+inline void RpcHeader::clear_method_index() {
+  _impl_.method_index_ = 0u;
+}
+inline uint32_t RpcHeader::_internal_method_index() const {
+  return _impl_.method_index_;
+}
+inline uint32_t RpcHeader::method_index() const {
+  // @@protoc_insertion_point(field_get:rpcheader.RpcHeader.method_index)
+  return _internal_method_index();
+}
+inline void RpcHeader::_internal_set_method_index(uint32_t value) {
+  
+  _impl_.method_index_ = value;
+}
+inline void RpcHeader::set_method_index(uint32_t value) {
+  _internal_set_method_index(value);
+  // @@protoc_insertion_point(field_set:rpcheader.RpcHeader.method_index)
+}
+
+// bytes metadata = 16;
+inline void RpcHeader::clear_metadata() {
+  _impl_.metadata_.ClearToEmpty();
+}
+inline const std::string& RpcHeader::metadata() const {
+  // @@protoc_insertion_point(field_get:rpcheader.RpcHeader.metadata)
+  return _internal_metadata();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void RpcHeader::set_metadata(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.metadata_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:rpcheader.RpcHeader.metadata)
+}
+inline std::string* RpcHeader::mutable_metadata() {
+  std::string* _s = _internal_mutable_metadata();
+  // @@protoc_insertion_point(field_mutable:rpcheader.RpcHeader.metadata)
+  return _s;
+}
+inline const std::string& RpcHeader::_internal_metadata() const {
+  return _impl_.metadata_.Get();
+}
+inline void RpcHeader::_internal_set_metadata(const std::string& value) {
+  
+  _impl_.metadata_.Set(value, GetArenaForAllocation());
+}
+inline std::string* RpcHeader::_internal_mutable_metadata() {
+  
+  return _impl_.metadata_.Mutable(GetArenaForAllocation());
+}
+inline std::string* RpcHeader::release_metadata() {
+  // @@protoc_insertion_point(field_release:rpcheader.RpcHeader.metadata)
+  return _impl_.metadata_.Release();
+}
+inline void RpcHeader::set_allocated_metadata(std::string* metadata) {
+  if (metadata != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.metadata_.SetAllocated(metadata, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.metadata_.IsDefault()) {
+    _impl_.metadata_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:rpcheader.RpcHeader.metadata)
+}
+
+// -------------------------------------------------------------------
+
+// RpcResponseHeader
+
+// .rpcheader.RpcStatus status = 1;
+inline void RpcResponseHeader::clear_status() {
+  _impl_.status_ = 0;
+}
+inline ::rpcheader::RpcStatus RpcResponseHeader::_internal_status() const {
+  return static_cast< ::rpcheader::RpcStatus >(_impl_.status_);
+}
+inline ::rpcheader::RpcStatus RpcResponseHeader::status() const {
+  // @@protoc_insertion_point(field_get:rpcheader.RpcResponseHeader.status)
+  return _internal_status();
+}
+inline void RpcResponseHeader::_internal_set_status(::rpcheader::RpcStatus value) {
+  
+  _impl_.status_ = value;
+}
+inline void RpcResponseHeader::set_status(::rpcheader::RpcStatus value) {
+  _internal_set_status(value);
+  // @@protoc_insertion_point(field_set:rpcheader.RpcResponseHeader.status)
+}
+
+// bytes error_text = 2;
+inline void RpcResponseHeader::clear_error_text() {
+  _impl_.error_text_.ClearToEmpty();
+}
+inline const std::string& RpcResponseHeader::error_text() const {
+  // @@protoc_insertion_point(field_get:rpcheader.RpcResponseHeader.error_text)
+  return _internal_error_text();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void RpcResponseHeader::set_error_text(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.error_text_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:rpcheader.RpcResponseHeader.error_text)
+}
+inline std::string* RpcResponseHeader::mutable_error_text() {
+  std::string* _s = _internal_mutable_error_text();
+  // @@protoc_insertion_point(field_mutable:rpcheader.RpcResponseHeader.error_text)
+  return _s;
+}
+inline const std::string& RpcResponseHeader::_internal_error_text() const {
+  return _impl_.error_text_.Get();
+}
+inline void RpcResponseHeader::_internal_set_error_text(const std::string& value) {
+  
+  _impl_.error_text_.Set(value, GetArenaForAllocation());
+}
+inline std::string* RpcResponseHeader::_internal_mutable_error_text() {
+  
+  return _impl_.error_text_.Mutable(GetArenaForAllocation());
+}
+inline std::string* RpcResponseHeader::release_error_text() {
+  // @@protoc_insertion_point(field_release:rpcheader.RpcResponseHeader.error_text)
+  return _impl_.error_text_.Release();
+}
+inline void RpcResponseHeader::set_allocated_error_text(std::string* error_text) {
+  if (error_text != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.error_text_.SetAllocated(error_text, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.error_text_.IsDefault()) {
+    _impl_.error_text_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:rpcheader.RpcResponseHeader.error_text)
+}
+
+// uint32 body_size = 3;
+inline void RpcResponseHeader::clear_body_size() {
+  _impl_.body_size_ = 0u;
+}
+inline uint32_t RpcResponseHeader::_internal_body_size() const {
+  return _impl_.body_size_;
+}
+inline uint32_t RpcResponseHeader::body_size() const {
+  // @@protoc_insertion_point(field_get:rpcheader.RpcResponseHeader.body_size)
+  return _internal_body_size();
+}
+inline void RpcResponseHeader::_internal_set_body_size(uint32_t value) {
+  
+  _impl_.body_size_ = value;
+}
+inline void RpcResponseHeader::set_body_size(uint32_t value) {
+  _internal_set_body_size(value);
+  // @@protoc_insertion_point(field_set:rpcheader.RpcResponseHeader.body_size)
+}
+
+// uint64 request_id = 4;
+inline void RpcResponseHeader::clear_request_id() {
+  _impl_.request_id_ = uint64_t{0u};
+}
+inline uint64_t RpcResponseHeader::_internal_request_id() const {
+  return _impl_.request_id_;
+}
+inline uint64_t RpcResponseHeader::request_id() const {
+  // @@protoc_insertion_point(field_get:rpcheader.RpcResponseHeader.request_id)
+  return _internal_request_id();
+}
+inline void RpcResponseHeader::_internal_set_request_id(uint64_t value) {
+  
+  _impl_.request_id_ = value;
+}
+inline void RpcResponseHeader::set_request_id(uint64_t value) {
+  _internal_set_request_id(value);
+  // @@protoc_insertion_point(field_set:rpcheader.RpcResponseHeader.request_id)
+}
+
+// uint32 batch_count = 5;
+inline void RpcResponseHeader::clear_batch_count() {
+  _impl_.batch_count_ = 0u;
+}
+inline uint32_t RpcResponseHeader::_internal_batch_count() const {
+  return _impl_.batch_count_;
+}
+inline uint32_t RpcResponseHeader::batch_count() const {
+  // @@protoc_insertion_point(field_get:rpcheader.RpcResponseHeader.batch_count)
+  return _internal_batch_count();
+}
+inline void RpcResponseHeader::_internal_set_batch_count(uint32_t value) {
+  
+  _impl_.batch_count_ = value;
+}
+inline void RpcResponseHeader::set_batch_count(uint32_t value) {
+  _internal_set_batch_count(value);
+  // @@protoc_insertion_point(field_set:rpcheader.RpcResponseHeader.batch_count)
+}
+
+// .rpcheader.FrameType frame_type = 6;
+inline void RpcResponseHeader::clear_frame_type() {
+  _impl_.frame_type_ = 0;
+}
+inline ::rpcheader::FrameType RpcResponseHeader::_internal_frame_type() const {
+  return static_cast< ::rpcheader::FrameType >(_impl_.frame_type_);
+}
+inline ::rpcheader::FrameType RpcResponseHeader::frame_type() const {
+  // @@protoc_insertion_point(field_get:rpcheader.RpcResponseHeader.frame_type)
+  return _internal_frame_type();
+}
+inline void RpcResponseHeader::_internal_set_frame_type(::rpcheader::FrameType value) {
+  
+  _impl_.frame_type_ = value;
+}
+inline void RpcResponseHeader::set_frame_type(::rpcheader::FrameType value) {
+  _internal_set_frame_type(value);
+  // @@protoc_insertion_point(field_set:rpcheader.RpcResponseHeader.frame_type)
+}
+
+// uint32 credit = 7;
+inline void RpcResponseHeader::clear_credit() {
+  _impl_.credit_ = 0u;
+}
+inline uint32_t RpcResponseHeader::_internal_credit() const {
+  return _impl_.credit_;
+}
+inline uint32_t RpcResponseHeader::credit() const {
+  // @@protoc_insertion_point(field_get:rpcheader.RpcResponseHeader.credit)
+  return _internal_credit();
+}
+inline void RpcResponseHeader::_internal_set_credit(uint32_t value) {
+  
+  _impl_.credit_ = value;
+}
+inline void RpcResponseHeader::set_credit(uint32_t value) {
+  _internal_set_credit(value);
+  // @@protoc_insertion_point(field_set:rpcheader.RpcResponseHeader.credit)
+}
+
+// .rpcheader.CompressionType compression = 8;
+inline void RpcResponseHeader::clear_compression() {
+  _impl_.compression_ = 0;
+}
+inline ::rpcheader::CompressionType RpcResponseHeader::_internal_compression() const {
+  return static_cast< ::rpcheader::CompressionType >(_impl_.compression_);
+}
+inline ::rpcheader::CompressionType RpcResponseHeader::compression() const {
+  // @@protoc_insertion_point(field_get:rpcheader.RpcResponseHeader.compression)
+  return _internal_compression();
+}
+inline void RpcResponseHeader::_internal_set_compression(::rpcheader::CompressionType value) {
+  
+  _impl_.compression_ = value;
+}
+inline void RpcResponseHeader::set_compression(::rpcheader::CompressionType value) {
+  _internal_set_compression(value);
+  // @@protoc_insertion_point(field_set:rpcheader.RpcResponseHeader.compression)
+}
+
+// uint32 uncompressed_size = 9;
+inline void RpcResponseHeader::clear_uncompressed_size() {
+  _impl_.uncompressed_size_ = 0u;
+}
+inline uint32_t RpcResponseHeader::_internal_uncompressed_size() const {
+  return _impl_.uncompressed_size_;
+}
+inline uint32_t RpcResponseHeader::uncompressed_size() const {
+  // @@protoc_insertion_point(field_get:rpcheader.RpcResponseHeader.uncompressed_size)
+  return _internal_uncompressed_size();
+}
+inline void RpcResponseHeader::_internal_set_uncompressed_size(uint32_t value) {
+  
+  _impl_.uncompressed_size_ = value;
+}
+inline void RpcResponseHeader::set_uncompressed_size(uint32_t value) {
+  _internal_set_uncompressed_size(value);
+  // @@protoc_insertion_point(field_set:rpcheader.RpcResponseHeader.uncompressed_size)
+}
+
+// bytes metadata = 12;
+inline void RpcResponseHeader::clear_metadata() {
+  _impl_.metadata_.ClearToEmpty();
+}
+inline const std::string& RpcResponseHeader::metadata() const {
+  // @@protoc_insertion_point(field_get:rpcheader.RpcResponseHeader.metadata)
+  return _internal_metadata();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void RpcResponseHeader::set_metadata(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.metadata_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:rpcheader.RpcResponseHeader.metadata)
+}
+inline std::string* RpcResponseHeader::mutable_metadata() {
+  std::string* _s = _internal_mutable_metadata();
+  // @@protoc_insertion_point(field_mutable:rpcheader.RpcResponseHeader.metadata)
+  return _s;
+}
+inline const std::string& RpcResponseHeader::_internal_metadata() const {
+  return _impl_.metadata_.Get();
+}
+inline void RpcResponseHeader::_internal_set_metadata(const std::string& value) {
+  
+  _impl_.metadata_.Set(value, GetArenaForAllocation());
+}
+inline std::string* RpcResponseHeader::_internal_mutable_metadata() {
+  
+  return _impl_.metadata_.Mutable(GetArenaForAllocation());
+}
+inline std::string* RpcResponseHeader::release_metadata() {
+  // @@protoc_insertion_point(field_release:rpcheader.RpcResponseHeader.metadata)
+  return _impl_.metadata_.Release();
+}
+inline void RpcResponseHeader::set_allocated_metadata(std::string* metadata) {
+  if (metadata != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.metadata_.SetAllocated(metadata, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.metadata_.IsDefault()) {
+    _impl_.metadata_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:rpcheader.RpcResponseHeader.metadata)
+}
+
+// -------------------------------------------------------------------
+
+// Handshake
+
+// uint32 protocol_version = 1;
+inline void Handshake::clear_protocol_version() {
+  _impl_.protocol_version_ = 0u;
+}
+inline uint32_t Handshake::_internal_protocol_version() const {
+  return _impl_.protocol_version_;
+}
+inline uint32_t Handshake::protocol_version() const {
+  // @@protoc_insertion_point(field_get:rpcheader.Handshake.protocol_version)
+  return _internal_protocol_version();
+}
+inline void Handshake::_internal_set_protocol_version(uint32_t value) {
+  
+  _impl_.protocol_version_ = value;
+}
+inline void Handshake::set_protocol_version(uint32_t value) {
+  _internal_set_protocol_version(value);
+  // @@protoc_insertion_point(field_set:rpcheader.Handshake.protocol_version)
+}
+
+// uint32 compression = 2;
+inline void Handshake::clear_compression() {
+  _impl_.compression_ = 0u;
+}
+inline uint32_t Handshake::_internal_compression() const {
+  return _impl_.compression_;
+}
+inline uint32_t Handshake::compression() const {
+  // @@protoc_insertion_point(field_get:rpcheader.Handshake.compression)
+  return _internal_compression();
+}
+inline void Handshake::_internal_set_compression(uint32_t value) {
+  
+  _impl_.compression_ = value;
+}
+inline void Handshake::set_compression(uint32_t value) {
+  _internal_set_compression(value);
+  // @@protoc_insertion_point(field_set:rpcheader.Handshake.compression)
+}
+
+// uint64 max_message_size = 3;
+inline void Handshake::clear_max_message_size() {
+  _impl_.max_message_size_ = uint64_t{0u};
+}
+inline uint64_t Handshake::_internal_max_message_size() const {
+  return _impl_.max_message_size_;
+}
+inline uint64_t Handshake::max_message_size() const {
+  // @@protoc_insertion_point(field_get:rpcheader.Handshake.max_message_size)
+  return _internal_max_message_size();
+}
+inline void Handshake::_internal_set_max_message_size(uint64_t value) {
+  
+  _impl_.max_message_size_ = value;
+}
+inline void Handshake::set_max_message_size(uint64_t value) {
+  _internal_set_max_message_size(value);
+  // @@protoc_insertion_point(field_set:rpcheader.Handshake.max_message_size)
+}
+
+// bool multiplexing = 4;
+inline void Handshake::clear_multiplexing() {
+  _impl_.multiplexing_ = false;
+}
+inline bool Handshake::_internal_multiplexing() const {
+  return _impl_.multiplexing_;
+}
+inline bool Handshake::multiplexing() const {
+  // @@protoc_insertion_point(field_get:rpcheader.Handshake.multiplexing)
+  return _internal_multiplexing();
+}
+inline void Handshake::_internal_set_multiplexing(bool value) {
+  
+  _impl_.multiplexing_ = value;
+}
+inline void Handshake::set_multiplexing(bool value) {
+  _internal_set_multiplexing(value);
+  // @@protoc_insertion_point(field_set:rpcheader.Handshake.multiplexing)
+}
+
+// bool checksum = 5;
+inline void Handshake::clear_checksum() {
+  _impl_.checksum_ = false;
+}
+inline bool Handshake::_internal_checksum() const {
+  return _impl_.checksum_;
+}
+inline bool Handshake::checksum() const {
+  // @@protoc_insertion_point(field_get:rpcheader.Handshake.checksum)
+  return _internal_checksum();
+}
+inline void Handshake::_internal_set_checksum(bool value) {
+  
+  _impl_.checksum_ = value;
+}
+inline void Handshake::set_checksum(bool value) {
+  _internal_set_checksum(value);
+  // @@protoc_insertion_point(field_set:rpcheader.Handshake.checksum)
+}
+
+// repeated uint32 ambiguous_method_ids = 6;
+inline int Handshake::_internal_ambiguous_method_ids_size() const {
+  return _impl_.ambiguous_method_ids_.size();
+}
+inline int Handshake::ambiguous_method_ids_size() const {
+  return _internal_ambiguous_method_ids_size();
+}
+inline void Handshake::clear_ambiguous_method_ids() {
+  _impl_.ambiguous_method_ids_.Clear();
+}
+inline uint32_t Handshake::_internal_ambiguous_method_ids(int index) const {
+  return _impl_.ambiguous_method_ids_.Get(index);
+}
+inline uint32_t Handshake::ambiguous_method_ids(int index) const {
+  // @@protoc_insertion_point(field_get:rpcheader.Handshake.ambiguous_method_ids)
+  return _internal_ambiguous_method_ids(index);
+}
+inline void Handshake::set_ambiguous_method_ids(int index, uint32_t value) {
+  _impl_.ambiguous_method_ids_.Set(index, value);
+  // @@protoc_insertion_point(field_set:rpcheader.Handshake.ambiguous_method_ids)
+}
+inline void Handshake::_internal_add_ambiguous_method_ids(uint32_t value) {
+  _impl_.ambiguous_method_ids_.Add(value);
+}
+inline void Handshake::add_ambiguous_method_ids(uint32_t value) {
+  _internal_add_ambiguous_method_ids(value);
+  // @@protoc_insertion_point(field_add:rpcheader.Handshake.ambiguous_method_ids)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+Handshake::_internal_ambiguous_method_ids() const {
+  return _impl_.ambiguous_method_ids_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+Handshake::ambiguous_method_ids() const {
+  // @@protoc_insertion_point(field_list:rpcheader.Handshake.ambiguous_method_ids)
+  return _internal_ambiguous_method_ids();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+Handshake::_internal_mutable_ambiguous_method_ids() {
+  return &_impl_.ambiguous_method_ids_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+Handshake::mutable_ambiguous_method_ids() {
+  // @@protoc_insertion_point(field_mutable_list:rpcheader.Handshake.ambiguous_method_ids)
+  return _internal_mutable_ambiguous_method_ids();
+}
+
 #ifdef __GNUC__
   #pragma GCC diagnostic pop
 #endif  // __GNUC__
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
 
 // @@protoc_insertion_point(namespace_scope)
 
 }  // namespace rpcheader
 
+PROTOBUF_NAMESPACE_OPEN
+
+template <> struct is_proto_enum< ::rpcheader::FrameType> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::rpcheader::FrameType>() {
+  return ::rpcheader::FrameType_descriptor();
+}
+template <> struct is_proto_enum< ::rpcheader::CompressionType> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::rpcheader::CompressionType>() {
+  return ::rpcheader::CompressionType_descriptor();
+}
+template <> struct is_proto_enum< ::rpcheader::RpcStatus> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::rpcheader::RpcStatus>() {
+  return ::rpcheader::RpcStatus_descriptor();
+}
+
+PROTOBUF_NAMESPACE_CLOSE
+
 // @@protoc_insertion_point(global_scope)
 
-#endif  // PROTOBUF_INCLUDED_rpcheader_2eproto
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_rpcheader_2eproto
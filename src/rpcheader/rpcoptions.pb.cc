@@ -0,0 +1,111 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: rpcoptions.proto
+
+#include "rpcoptions.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
+
+namespace rpcoptions {
+}  // namespace rpcoptions
+static const ::_pb::EnumDescriptor* file_level_enum_descriptors_rpcoptions_2eproto[2];
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_rpcoptions_2eproto = nullptr;
+const uint32_t TableStruct_rpcoptions_2eproto::offsets[1] = {};
+static constexpr ::_pbi::MigrationSchema* schemas = nullptr;
+static constexpr ::_pb::Message* const* file_default_instances = nullptr;
+
+const char descriptor_table_protodef_rpcoptions_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\020rpcoptions.proto\022\nrpcoptions\032 google/p"
+  "rotobuf/descriptor.proto*P\n\016MethodPriori"
+  "ty\022\023\n\017PRIORITY_NORMAL\020\000\022\025\n\021PRIORITY_CRIT"
+  "ICAL\020\001\022\022\n\016PRIORITY_BATCH\020\002*c\n\rStreamingM"
+  "ode\022\022\n\016STREAMING_NONE\020\000\022\024\n\020STREAMING_SER"
+  "VER\020\001\022\024\n\020STREAMING_CLIENT\020\002\022\022\n\016STREAMING"
+  "_BIDI\020\003:N\n\010priority\022\036.google.protobuf.Me"
+  "thodOptions\030\321\206\003 \001(\0162\032.rpcoptions.MethodP"
+  "riority:1\n\007one_way\022\036.google.protobuf.Met"
+  "hodOptions\030\322\206\003 \001(\010:N\n\tstreaming\022\036.google"
+  ".protobuf.MethodOptions\030\323\206\003 \001(\0162\031.rpcopt"
+  "ions.StreamingModeb\006proto3"
+  ;
+static const ::_pbi::DescriptorTable* const descriptor_table_rpcoptions_2eproto_deps[1] = {
+  &::descriptor_table_google_2fprotobuf_2fdescriptor_2eproto,
+};
+static ::_pbi::once_flag descriptor_table_rpcoptions_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_rpcoptions_2eproto = {
+    false, false, 466, descriptor_table_protodef_rpcoptions_2eproto,
+    "rpcoptions.proto",
+    &descriptor_table_rpcoptions_2eproto_once, descriptor_table_rpcoptions_2eproto_deps, 1, 0,
+    schemas, file_default_instances, TableStruct_rpcoptions_2eproto::offsets,
+    nullptr, file_level_enum_descriptors_rpcoptions_2eproto,
+    file_level_service_descriptors_rpcoptions_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_rpcoptions_2eproto_getter() {
+  return &descriptor_table_rpcoptions_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_rpcoptions_2eproto(&descriptor_table_rpcoptions_2eproto);
+namespace rpcoptions {
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* MethodPriority_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_rpcoptions_2eproto);
+  return file_level_enum_descriptors_rpcoptions_2eproto[0];
+}
+bool MethodPriority_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+    case 2:
+      return true;
+    default:
+      return false;
+  }
+}
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* StreamingMode_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_rpcoptions_2eproto);
+  return file_level_enum_descriptors_rpcoptions_2eproto[1];
+}
+bool StreamingMode_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+    case 2:
+    case 3:
+      return true;
+    default:
+      return false;
+  }
+}
+
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 ::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::PROTOBUF_NAMESPACE_ID::MethodOptions,
+    ::PROTOBUF_NAMESPACE_ID::internal::EnumTypeTraits< ::rpcoptions::MethodPriority, ::rpcoptions::MethodPriority_IsValid>, 14, false>
+  priority(kPriorityFieldNumber, static_cast< ::rpcoptions::MethodPriority >(0), nullptr);
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 ::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::PROTOBUF_NAMESPACE_ID::MethodOptions,
+    ::PROTOBUF_NAMESPACE_ID::internal::PrimitiveTypeTraits< bool >, 8, false>
+  one_way(kOneWayFieldNumber, false, nullptr);
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 ::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::PROTOBUF_NAMESPACE_ID::MethodOptions,
+    ::PROTOBUF_NAMESPACE_ID::internal::EnumTypeTraits< ::rpcoptions::StreamingMode, ::rpcoptions::StreamingMode_IsValid>, 14, false>
+  streaming(kStreamingFieldNumber, static_cast< ::rpcoptions::StreamingMode >(0), nullptr);
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace rpcoptions
+PROTOBUF_NAMESPACE_OPEN
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
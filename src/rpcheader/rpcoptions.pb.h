@@ -0,0 +1,154 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: rpcoptions.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_rpcoptions_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_rpcoptions_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/generated_enum_reflection.h>
+#include <google/protobuf/descriptor.pb.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_rpcoptions_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_rpcoptions_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_rpcoptions_2eproto;
+PROTOBUF_NAMESPACE_OPEN
+PROTOBUF_NAMESPACE_CLOSE
+namespace rpcoptions {
+
+enum MethodPriority : int {
+  PRIORITY_NORMAL = 0,
+  PRIORITY_CRITICAL = 1,
+  PRIORITY_BATCH = 2,
+  MethodPriority_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  MethodPriority_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
+};
+bool MethodPriority_IsValid(int value);
+constexpr MethodPriority MethodPriority_MIN = PRIORITY_NORMAL;
+constexpr MethodPriority MethodPriority_MAX = PRIORITY_BATCH;
+constexpr int MethodPriority_ARRAYSIZE = MethodPriority_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* MethodPriority_descriptor();
+template<typename T>
+inline const std::string& MethodPriority_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, MethodPriority>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function MethodPriority_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    MethodPriority_descriptor(), enum_t_value);
+}
+inline bool MethodPriority_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, MethodPriority* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<MethodPriority>(
+    MethodPriority_descriptor(), name, value);
+}
+enum StreamingMode : int {
+  STREAMING_NONE = 0,
+  STREAMING_SERVER = 1,
+  STREAMING_CLIENT = 2,
+  STREAMING_BIDI = 3,
+  StreamingMode_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  StreamingMode_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
+};
+bool StreamingMode_IsValid(int value);
+constexpr StreamingMode StreamingMode_MIN = STREAMING_NONE;
+constexpr StreamingMode StreamingMode_MAX = STREAMING_BIDI;
+constexpr int StreamingMode_ARRAYSIZE = StreamingMode_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* StreamingMode_descriptor();
+template<typename T>
+inline const std::string& StreamingMode_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, StreamingMode>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function StreamingMode_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    StreamingMode_descriptor(), enum_t_value);
+}
+inline bool StreamingMode_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, StreamingMode* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<StreamingMode>(
+    StreamingMode_descriptor(), name, value);
+}
+// ===================================================================
+
+
+// ===================================================================
+
+static const int kPriorityFieldNumber = 50001;
+extern ::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::PROTOBUF_NAMESPACE_ID::MethodOptions,
+    ::PROTOBUF_NAMESPACE_ID::internal::EnumTypeTraits< ::rpcoptions::MethodPriority, ::rpcoptions::MethodPriority_IsValid>, 14, false >
+  priority;
+static const int kOneWayFieldNumber = 50002;
+extern ::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::PROTOBUF_NAMESPACE_ID::MethodOptions,
+    ::PROTOBUF_NAMESPACE_ID::internal::PrimitiveTypeTraits< bool >, 8, false >
+  one_way;
+static const int kStreamingFieldNumber = 50003;
+extern ::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::PROTOBUF_NAMESPACE_ID::MethodOptions,
+    ::PROTOBUF_NAMESPACE_ID::internal::EnumTypeTraits< ::rpcoptions::StreamingMode, ::rpcoptions::StreamingMode_IsValid>, 14, false >
+  streaming;
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace rpcoptions
+
+PROTOBUF_NAMESPACE_OPEN
+
+template <> struct is_proto_enum< ::rpcoptions::MethodPriority> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::rpcoptions::MethodPriority>() {
+  return ::rpcoptions::MethodPriority_descriptor();
+}
+template <> struct is_proto_enum< ::rpcoptions::StreamingMode> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::rpcoptions::StreamingMode>() {
+  return ::rpcoptions::StreamingMode_descriptor();
+}
+
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_rpcoptions_2eproto
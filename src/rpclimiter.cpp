@@ -0,0 +1,77 @@
+#include "rpclimiter.h"
+#include <algorithm>
+#include <cmath>
+
+ConcurrencyLimiter::ConcurrencyLimiter(const Options& options) :
+    options_(options),
+    limit_(options.initial_limit),
+    window_start_(std::chrono::steady_clock::now()) {}
+
+bool ConcurrencyLimiter::TryAcquire() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (inflight_ >= static_cast<int>(limit_)) {
+        return false;   // 超过并发上限，立即拒绝
+    }
+    ++inflight_;
+    window_max_inflight_ = std::max(window_max_inflight_, inflight_);
+    return true;
+}
+
+void ConcurrencyLimiter::Release(std::chrono::steady_clock::duration rtt) {
+    double rtt_us = std::chrono::duration<double, std::micro>(rtt).count();
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    --inflight_;
+
+    // 累计窗口样本
+    window_rtt_sum_ += rtt_us;
+    window_rtt_min_ = window_samples_ == 0 ? rtt_us : std::min(window_rtt_min_, rtt_us);
+    ++window_samples_;
+
+    auto now = std::chrono::steady_clock::now();
+    if (window_samples_ >= options_.window_min_samples &&
+        now - window_start_ >= std::chrono::milliseconds(options_.window_ms)) {
+        UpdateLimit();
+        window_start_ = now;
+        window_rtt_sum_ = 0;
+        window_samples_ = 0;
+        window_max_inflight_ = inflight_;
+    }
+}
+
+void ConcurrencyLimiter::Cancel() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    --inflight_;
+}
+
+int ConcurrencyLimiter::GetLimit() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return static_cast<int>(limit_);
+}
+
+int ConcurrencyLimiter::GetInflight() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return inflight_;
+}
+
+void ConcurrencyLimiter::UpdateLimit() {
+    double sample_rtt = window_rtt_sum_ / window_samples_;
+
+    // 周期性地用当前窗口的最小 RTT 重置基准，使 rtt_noload 能跟随服务真实耗时的变化
+    if (++windows_ % options_.noload_reset_windows == 0 || rtt_noload_ == 0) {
+        rtt_noload_ = window_rtt_min_;
+    } else {
+        rtt_noload_ = std::min(rtt_noload_, window_rtt_min_);
+    }
+
+    double gradient = std::max(0.5, std::min(1.0, options_.tolerance * rtt_noload_ / sample_rtt));
+    double new_limit = limit_ * gradient + std::sqrt(limit_);
+
+    // 窗口内在途请求从未接近上限时（应用本身负载低），RTT 不能反映上限是否合适，不增长 limit
+    if (new_limit > limit_ && window_max_inflight_ < limit_ / 2) {
+        return;
+    }
+
+    limit_ = limit_ * (1 - options_.smoothing) + new_limit * options_.smoothing;
+    limit_ = std::max<double>(options_.min_limit, std::min<double>(options_.max_limit, limit_));
+}
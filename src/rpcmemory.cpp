@@ -0,0 +1,79 @@
+#include "rpcmemory.h"
+#include "rpcmetrics.h"
+
+RpcMemoryBudget::RpcMemoryBudget()
+    : used_(RpcMetrics::GetInstance().Counter("provider.memory_bytes")),
+      kinds_{&RpcMetrics::GetInstance().Counter("provider.memory_read_bytes"),
+             &RpcMetrics::GetInstance().Counter("provider.memory_call_bytes"),
+             &RpcMetrics::GetInstance().Counter("provider.memory_write_bytes")},
+      sessionMax_(RpcMetrics::GetInstance().Counter("provider.memory_session_max_bytes")),
+      pauses_(RpcMetrics::GetInstance().Counter("provider.memory_read_pauses")) {}
+
+RpcMemoryBudget::~RpcMemoryBudget() {
+    DropWaiters();
+}
+
+void RpcMemoryBudget::SetLimit(int64_t limit) {
+    limit_.store(limit > 0 ? limit : 0, std::memory_order_relaxed);
+}
+
+void RpcMemoryBudget::Add(Kind kind, int64_t bytes) {
+    kinds_[static_cast<int>(kind)]->fetch_add(bytes, std::memory_order_relaxed);
+    used_.fetch_add(bytes);
+    // 与 WaitBelow 的登记、复查顺序配合（均为 seq_cst），不会遗漏等待中的会话
+    if (bytes < 0 && waiting_.load() > 0 && BelowResume()) {
+        WakeWaiters();
+    }
+}
+
+void RpcMemoryBudget::ObserveSession(int64_t bytes) {
+    int64_t max = sessionMax_.load(std::memory_order_relaxed);
+    while (bytes > max && !sessionMax_.compare_exchange_weak(max, bytes, std::memory_order_relaxed)) {
+    }
+}
+
+bool RpcMemoryBudget::Exceeded() const {
+    int64_t limit = limit_.load(std::memory_order_relaxed);
+    return limit > 0 && used_.load(std::memory_order_relaxed) >= limit;
+}
+
+bool RpcMemoryBudget::BelowResume() const {
+    int64_t limit = limit_.load(std::memory_order_relaxed);
+    return limit == 0 || used_.load() < limit - limit / 8;
+}
+
+void RpcMemoryBudget::WaitBelow(std::function<void()> resume) {
+    pauses_.fetch_add(1, std::memory_order_relaxed);
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        waiters_.push_back(std::move(resume));
+        waiting_.fetch_add(1);
+    }
+    // 登记之前内存可能已经回落，释放者没有看到这个回调
+    if (BelowResume()) {
+        WakeWaiters();
+    }
+}
+
+void RpcMemoryBudget::DropWaiters() {
+    // 回调持有的会话析构时仍会调用 Add，先清空计数，避免在析构期间再次唤醒
+    std::vector<std::function<void()>> waiters;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        waiters.swap(waiters_);
+        waiting_.store(0);
+    }
+    waiters.clear();
+}
+
+void RpcMemoryBudget::WakeWaiters() {
+    std::vector<std::function<void()>> waiters;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        waiters.swap(waiters_);
+        waiting_.store(0);
+    }
+    for (std::function<void()>& resume : waiters) {
+        resume();
+    }
+}
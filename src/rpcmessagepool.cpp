@@ -0,0 +1,155 @@
+#include "rpcmessagepool.h"
+#include <algorithm>
+#include "rpcmetrics.h"
+
+/**
+ * @brief 一个线程中一个编号的空闲链表，属于代数为 generation_ 的对象池
+ */
+struct MessagePoolCache {
+    /**
+     * @brief 释放链表中的对象
+     */
+    void Clear() {
+        for (google::protobuf::Message* message : messages_) {
+            delete message;
+        }
+        messages_.clear();
+    }
+
+    uint64_t generation_ = 0;
+    std::vector<google::protobuf::Message*> messages_;
+};
+
+/**
+ * @brief 一个线程中所有对象池的空闲链表，下标为对象池编号；线程退出时释放其中的对象
+ */
+struct MessagePoolCaches {
+    ~MessagePoolCaches() {
+        for (MessagePoolCache& cache : caches_) {
+            cache.Clear();
+        }
+    }
+
+    std::vector<MessagePoolCache> caches_;
+};
+
+/**
+ * @brief 对象池编号的分配：析构的对象池归还编号，线程缓存的长度不超过同时存在的对象池数
+ */
+struct MessagePoolIds {
+    std::mutex mutex_;
+    std::vector<size_t> free_;      // 已归还的编号
+    size_t next_ = 0;               // 下一个新编号
+    uint64_t generation_ = 0;       // 最近分配的代数
+};
+
+/**
+ * @brief 编号分配状态（进程退出时不析构，静态对象池可能晚于它析构）
+ */
+static MessagePoolIds& PoolIds() {
+    static MessagePoolIds* ids = new MessagePoolIds;
+    return *ids;
+}
+
+/**
+ * @brief 分配对象池编号及代数
+ * @param generation 输出参数，代数
+ * @return 编号
+ */
+static size_t AcquirePoolId(uint64_t* generation) {
+    MessagePoolIds& ids = PoolIds();
+    std::lock_guard<std::mutex> lock(ids.mutex_);
+    *generation = ++ids.generation_;
+    if (ids.free_.empty()) {
+        return ids.next_++;
+    }
+    size_t id = ids.free_.back();
+    ids.free_.pop_back();
+    return id;
+}
+
+RpcMessagePool::RpcMessagePool(const google::protobuf::Message* prototype, const Options& options)
+    : prototype_(prototype),
+      options_(options),
+      hits_(RpcMetrics::GetInstance().Counter("provider.message_pool_hits")),
+      misses_(RpcMetrics::GetInstance().Counter("provider.message_pool_misses")),
+      drops_(RpcMetrics::GetInstance().Counter("provider.message_pool_drops")) {
+    options_.max_per_thread = std::max<size_t>(options_.max_per_thread, 1);
+    id_ = AcquirePoolId(&generation_);
+}
+
+RpcMessagePool::~RpcMessagePool() {
+    for (google::protobuf::Message* message : shared_) {
+        delete message;
+    }
+    MessagePoolIds& ids = PoolIds();
+    std::lock_guard<std::mutex> lock(ids.mutex_);
+    ids.free_.push_back(id_);
+}
+
+std::vector<google::protobuf::Message*>& RpcMessagePool::LocalCache() {
+    thread_local MessagePoolCaches caches;
+    if (caches.caches_.size() <= id_) {
+        caches.caches_.resize(id_ + 1);
+    }
+    MessagePoolCache& cache = caches.caches_[id_];
+    if (cache.generation_ != generation_) {
+        // 编号被新的对象池复用：释放已析构对象池留下的对象
+        cache.Clear();
+        cache.generation_ = generation_;
+    }
+    return cache.messages_;
+}
+
+google::protobuf::Message* RpcMessagePool::Acquire() {
+    std::vector<google::protobuf::Message*>& cache = LocalCache();
+    if (cache.empty()) {
+        // 从共享链表取回一批（最多半个线程缓存），之后的 Acquire 不再加锁
+        std::lock_guard<std::mutex> lock(mutex_);
+        size_t count = std::min(shared_.size(), std::max<size_t>(options_.max_per_thread / 2, 1));
+        cache.insert(cache.end(), shared_.end() - count, shared_.end());
+        shared_.resize(shared_.size() - count);
+    }
+    if (cache.empty()) {
+        misses_.fetch_add(1, std::memory_order_relaxed);
+        return prototype_->New();
+    }
+    hits_.fetch_add(1, std::memory_order_relaxed);
+    google::protobuf::Message* message = cache.back();
+    cache.pop_back();
+    return message;
+}
+
+void RpcMessagePool::Release(google::protobuf::Message* message, size_t bytes) {
+    if (bytes > options_.max_message_bytes) {
+        drops_.fetch_add(1, std::memory_order_relaxed);
+        delete message;
+        return;
+    }
+    message->Clear();
+
+    std::vector<google::protobuf::Message*>& cache = LocalCache();
+    if (cache.size() >= options_.max_per_thread) {
+        // 线程缓存已满：把一半移到共享链表，供创建消息的线程（通常是IO线程）取回
+        size_t count = cache.size() - options_.max_per_thread / 2;
+        std::vector<google::protobuf::Message*> overflow;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            size_t room = options_.max_shared > shared_.size() ? options_.max_shared - shared_.size() : 0;
+            size_t moved = std::min(count, room);
+            shared_.insert(shared_.end(), cache.end() - moved, cache.end());
+            cache.resize(cache.size() - moved);
+            count -= moved;
+        }
+        // 共享链表也已满：多出的对象在锁外释放
+        if (count > 0) {
+            overflow.assign(cache.end() - count, cache.end());
+            cache.resize(cache.size() - count);
+            drops_.fetch_add(static_cast<int64_t>(overflow.size()), std::memory_order_relaxed);
+            for (google::protobuf::Message* dropped : overflow) {
+                delete dropped;
+            }
+        }
+    }
+    cache.push_back(message);
+}
@@ -0,0 +1,30 @@
+#include "rpcmetrics.h"
+
+RpcMetrics& RpcMetrics::GetInstance() {
+    static RpcMetrics instance;
+    return instance;
+}
+
+std::atomic<int64_t>& RpcMetrics::Counter(const std::string& name) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::unique_ptr<std::atomic<int64_t>>& counter = counters_[name];
+    if (!counter) {
+        counter.reset(new std::atomic<int64_t>(0));
+    }
+    return *counter;
+}
+
+std::map<std::string, int64_t> RpcMetrics::Snapshot() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::map<std::string, int64_t> snapshot;
+    for (const auto& counter : counters_) {
+        snapshot[counter.first] = counter.second->load(std::memory_order_relaxed);
+    }
+    return snapshot;
+}
+
+void RpcMetrics::Dump(std::ostream& os) const {
+    for (const auto& counter : Snapshot()) {
+        os << counter.first << " " << counter.second << "\n";
+    }
+}
@@ -1,7 +1,42 @@
 #include "rpcprovider.h"
 #include "rpcapplication.h"
+#include "rpcmetrics.h"
+#include "rpccompress.h"
+#include "rpcchecksum.h"
+#include "rpcframe.h"
+#include "rpchandshake.h"
+#include "rpcmessagepool.h"
+#include "rpcallocator.h"
 #include <google/protobuf/descriptor.h>
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
 #include "rpcheader.pb.h"
+#include "rpcoptions.pb.h"
+
+/**
+ * @brief 创建消息对象：开启对象池时从对象池取出
+ * @param pool 方法的对象池（未开启时为空）
+ * @param prototype 消息类型的原型
+ * @return 消息对象，通过 DeleteMessage 释放
+ */
+static google::protobuf::Message* NewMessage(RpcMessagePool* pool, const google::protobuf::Message& prototype) {
+    return pool ? pool->Acquire() : prototype.New();
+}
+
+/**
+ * @brief 释放消息对象：开启对象池时归还对象池
+ * @param pool 方法的对象池（未开启时为空）
+ * @param message 消息对象
+ * @param bytes 消息的序列化长度，未知时传 SIZE_MAX（归还对象池前计算）
+ */
+static void DeleteMessage(RpcMessagePool* pool, google::protobuf::Message* message, size_t bytes = SIZE_MAX) {
+    if (!pool) {
+        delete message;
+        return;
+    }
+    pool->Release(message, bytes == SIZE_MAX ? message->ByteSizeLong() : bytes);
+}
 
 void RpcProvider::NotifyService(google::protobuf::Service* service) {
     ServiceInfo serviceInfo;    // 创建服务信息对象
@@ -15,6 +50,27 @@ void RpcProvider::NotifyService(google::protobuf::Service* service) {
 
     std::cout << "NotifyService: service_name=" << service_name << std::endl;
 
+    // 预先解析各方法的压缩字典，发送响应时无锁查找
+    RpcCompressor::GetInstance().RegisterService(pserviceDesc);
+
+    // 是否开启自适应限流
+    bool limiter_enable = RpcApplication::GetConfig().Load<bool>("limiter.enable", false);
+    if (limiter_enable && !serverLimiter_) {
+        serverLimiter_.reset(new ConcurrencyLimiter(LoadLimiterOptions("limiter.server")));
+    }
+
+    // 实现了批处理接口的服务，其批处理方法的请求攒批后执行
+    RpcBatchService* batchService = dynamic_cast<RpcBatchService*>(service);
+    size_t batch_max_items = RpcApplication::GetConfig().Load<int>("batching.max_items", 32);
+    std::chrono::microseconds batch_max_delay(RpcApplication::GetConfig().Load<int>("batching.max_delay_us", 200));
+
+    // 请求/响应消息对象池：按方法缓存消息对象，复用代替每次调用的 New() / delete
+    bool pool_enable = RpcApplication::GetConfig().Load<bool>("message_pool.enable", false);
+    RpcMessagePool::Options pool_options;
+    pool_options.max_per_thread = RpcApplication::GetConfig().Load<size_t>("message_pool.max_per_thread", pool_options.max_per_thread);
+    pool_options.max_shared = RpcApplication::GetConfig().Load<size_t>("message_pool.max_shared", pool_options.max_shared);
+    pool_options.max_message_bytes = RpcApplication::GetConfig().Load<size_t>("message_pool.max_message_bytes", pool_options.max_message_bytes);
+
     // 填充serviceInfo对象
     serviceInfo.service_ = service;         // 保存服务对象本身
     for (int i = 0; i < methodCnt; ++i) {   // 遍历服务对象的所有方法
@@ -24,12 +80,105 @@ void RpcProvider::NotifyService(google::protobuf::Service* service) {
 
         std::cout << "NotifyService: method_name=" << method_name << std::endl;
 
-        // 存储服务方法名称和方法描述符的映射
-        serviceInfo.methodMap_.insert({method_name, pmethodDesc});
+        // 存储服务方法名称和方法信息的映射
+        MethodInfo methodInfo;
+        methodInfo.method_ = pmethodDesc;
+        methodInfo.priority_ = LoadMethodPriority(pmethodDesc);
+        methodInfo.memoryBytes_ = &RpcMetrics::GetInstance().Counter("provider.method." + pmethodDesc->full_name() + ".memory_bytes");
+        rpcoptions::StreamingMode streaming = pmethodDesc->options().GetExtension(rpcoptions::streaming);
+        methodInfo.streaming_ = streaming != rpcoptions::STREAMING_NONE;
+        methodInfo.clientStreaming_ = streaming == rpcoptions::STREAMING_CLIENT || streaming == rpcoptions::STREAMING_BIDI;
+        methodInfo.serverStreaming_ = streaming == rpcoptions::STREAMING_SERVER || streaming == rpcoptions::STREAMING_BIDI;
+        if (limiter_enable) {
+            methodInfo.limiter_.reset(new ConcurrencyLimiter(LoadLimiterOptions("limiter.method")));
+        }
+        if (pool_enable) {
+            methodInfo.requestPool_.reset(new RpcMessagePool(&service->GetRequestPrototype(pmethodDesc), pool_options));
+            methodInfo.responsePool_.reset(new RpcMessagePool(&service->GetResponsePrototype(pmethodDesc), pool_options));
+        }
+        if (batchService && !methodInfo.streaming_ && batchService->IsBatchMethod(pmethodDesc)) {
+            std::cout << "NotifyService: batch method " << method_name << std::endl;
+            methodInfo.batcher_.reset(new MethodBatcher(io_context_, batchService, std::max<size_t>(batch_max_items, 1), batch_max_delay));
+        }
+        serviceInfo.methodMap_.insert({method_name, std::move(methodInfo)});
     }
 
     // 存储服务名称和服务信息的映射
-    serviceMap_.insert({service_name, serviceInfo});
+    ServiceInfo& stored = serviceMap_.insert({service_name, std::move(serviceInfo)}).first->second;
+
+    // 登记方法id，哈希冲突的方法只能通过 protobuf 数据头中的名字调用：
+    // 冲突的方法id在握手回复中告知客户端，客户端对这些方法改用带名字的数据头
+    for (auto& method : stored.methodMap_) {
+        uint32_t method_id = RpcFrame::MethodId(method.second.method_);
+        auto result = methodIds_.insert({method_id, MethodRoute{&stored, &method.second}});
+        if (!result.second) {
+            std::cerr << "NotifyService: method id " << method_id << " of " << method.second.method_->full_name()
+                      << " collides, clients will call it by name" << std::endl;
+            result.first->second = MethodRoute{nullptr, nullptr};
+            auto pos = std::lower_bound(ambiguousMethodIds_.begin(), ambiguousMethodIds_.end(), method_id);
+            if (pos == ambiguousMethodIds_.end() || *pos != method_id) {
+                ambiguousMethodIds_.insert(pos, method_id);
+            }
+        }
+    }
+}
+
+ConcurrencyLimiter::Options RpcProvider::LoadLimiterOptions(const std::string& prefix) {
+    RpcConfig& config = RpcApplication::GetConfig();
+
+    ConcurrencyLimiter::Options options;
+    options.initial_limit = config.Load<int>(prefix + ".initial_limit", options.initial_limit);
+    options.min_limit = config.Load<int>(prefix + ".min_limit", options.min_limit);
+    options.max_limit = config.Load<int>(prefix + ".max_limit", options.max_limit);
+    options.smoothing = config.Load<double>("limiter.smoothing", options.smoothing);
+    options.tolerance = config.Load<double>("limiter.tolerance", options.tolerance);
+    options.window_ms = config.Load<int>("limiter.window_ms", options.window_ms);
+    return options;
+}
+
+RpcExecutor::Options RpcProvider::LoadExecutorOptions() {
+    RpcConfig& config = RpcApplication::GetConfig();
+
+    RpcExecutor::Options options;
+    options.threads = config.Load<int>("executor.threads", options.threads);
+    options.codel_enable = config.Load<bool>("executor.codel.enable", options.codel_enable);
+    options.codel_target_ms = config.Load<int>("executor.codel.target_ms", options.codel_target_ms);
+    options.codel_interval_ms = config.Load<int>("executor.codel.interval_ms", options.codel_interval_ms);
+    options.shed_mode = RpcExecutor::ParseShedMode(config.Load<std::string>("executor.codel.shed_mode", "drop_oldest"));
+    options.priority_strict = config.Load<std::string>("executor.priority.mode", "weighted") == "strict";
+    const char* priority_names[RpcExecutor::kPriorityCount] = {"critical", "normal", "batch"};
+    for (int i = 0; i < RpcExecutor::kPriorityCount; ++i) {
+        double weight = config.Load<double>(std::string("executor.priority.weights.") + priority_names[i],
+                                            options.priority_weights[i]);
+        if (weight > 0) {
+            options.priority_weights[i] = weight;
+        }
+    }
+    options.fair_queue_enable = config.Load<bool>("executor.fair_queue.enable", options.fair_queue_enable);
+    // 配置中的权重以租户名为key，与 HandleRequest 中租户流的命名保持一致
+    auto weights = config.Load<std::map<std::string, double>>("executor.fair_queue.weights", {});
+    for (const auto& weight : weights) {
+        options.flow_weights["tenant:" + weight.first] = weight.second;
+    }
+    return options;
+}
+
+RpcExecutor::Priority RpcProvider::LoadMethodPriority(const google::protobuf::MethodDescriptor* method) {
+    // 配置文件中的方法名包含 "."，无法通过 Load 的层级 key 直接访问，整体读取后再查找
+    auto overrides = RpcApplication::GetConfig().Load<std::map<std::string, std::string>>("executor.priority.methods", {});
+    auto it = overrides.find(method->service()->name() + "." + method->name());
+    if (it != overrides.end()) {
+        return RpcExecutor::ParsePriority(it->second);
+    }
+
+    switch (method->options().GetExtension(rpcoptions::priority)) {
+        case rpcoptions::PRIORITY_CRITICAL:
+            return RpcExecutor::Priority::Critical;
+        case rpcoptions::PRIORITY_BATCH:
+            return RpcExecutor::Priority::Batch;
+        default:
+            return RpcExecutor::Priority::Normal;
+    }
 }
 
 void RpcProvider::Run() {
@@ -38,6 +187,26 @@ void RpcProvider::Run() {
     std::string ip = RpcApplication::GetConfig().Load<std::string>("rpc.server_ip");
     uint16_t port = RpcApplication::GetConfig().Load<int>("rpc.server_port");
 
+    // 启动执行rpc方法的工作线程池
+    executor_.reset(new RpcExecutor(LoadExecutorOptions()));
+    RpcExecutor::Options stream_options = LoadExecutorOptions();
+    stream_options.threads = RpcApplication::GetConfig().Load<int>("stream.threads", 8);
+    streamExecutor_.reset(new RpcExecutor(stream_options));
+    writeCoalescing_ = RpcApplication::GetConfig().Load<bool>("rpc.write_coalescing", true);
+    streamWindow_ = RpcApplication::GetConfig().Load<int>("stream.window", 16);
+    chunkSize_ = RpcApplication::GetConfig().Load<size_t>("rpc.chunk_size", chunkSize_);
+    writeHighWater_ = RpcApplication::GetConfig().Load<size_t>("rpc.write_high_water", writeHighWater_);
+    writeLowWater_ = std::min(RpcApplication::GetConfig().Load<size_t>("rpc.write_low_water", writeLowWater_), writeHighWater_);
+    maxMessageSize_ = RpcApplication::GetConfig().Load<size_t>("rpc.max_message_size", maxMessageSize_);
+    checksum_ = RpcApplication::GetConfig().Load<bool>("rpc.checksum", false);
+    memory_.SetLimit(RpcApplication::GetConfig().Load<int64_t>("memory.budget_bytes", 0));
+    idleTimeout_ = RpcApplication::GetConfig().Load<uint32_t>("rpc.idle_timeout_s", 0);
+    maxConnections_ = RpcApplication::GetConfig().Load<size_t>("rpc.max_connections", 0);
+    trackSessions_ = idleTimeout_ > 0 || maxConnections_ > 0;
+    // 会话和读缓冲区的 slab 从大页区域中申请（需在接受第一个连接之前设置）
+    RpcPageArena::SetMode(RpcPageArena::ParseMode(
+        RpcApplication::GetConfig().Load<std::string>("memory.huge_pages", "off")));
+
     try {
         // 创建Acceptor对象，监听指定的IP和端口
         boost::asio::ip::tcp::acceptor acceptor(
@@ -62,16 +231,33 @@ void RpcProvider::Run() {
             * 6. 循环往复
          */
 
+        // 连接数达到上限时先关闭一个最久未活动的空闲连接，没有空闲连接时拒绝新连接
+        std::atomic<int64_t>& connections = RpcMetrics::GetInstance().Counter("provider.connections");
+        std::atomic<int64_t>& rejected = RpcMetrics::GetInstance().Counter("provider.connections_rejected");
+
         // 封装一个递归lambda函数用于接受连接
         std::function<void()> do_accept = [&, this]() {
             acceptor.async_accept(  // async_accept ：注册异步接受连接回调(不阻塞)，立即返回
                 // Tip. acceptor.async_accept(/* handler */); 
                 // 注册一次 async_accept 后，io_context_.run() 会监听该事件，当有连接到来时，调用该回调函数
                 // 注意只能接受一次连接，想要持续接受连接，必须递归调用
+                // 每个连接的 socket 绑定一个独立的 strand，该连接上的读写回调不会在多个IO线程中并发执行
+                boost::asio::make_strand(io_context_),
                 [&, this](boost::system::error_code ec, boost::asio::ip::tcp::socket socket) {
-                    if (!ec) {  // 如果接受连接没有错误
+                    if (!ec && maxConnections_ > 0 &&
+                        connections.load(std::memory_order_relaxed) >= static_cast<int64_t>(maxConnections_) &&
+                        !EvictIdleSession()) {
+                        rejected.fetch_add(1, std::memory_order_relaxed);
+                        boost::system::error_code ignored_ec;
+                        socket.close(ignored_ec);
+                    } else if (!ec) {  // 如果接受连接没有错误
                         // 创建一个新的session会话来处理连接
-                        auto session = std::make_shared<Session>(std::move(socket), *this);
+                        // 会话与其 shared_ptr 控制块从定长内存块池分配，连接频繁建立断开时不反复 malloc
+                        auto session = std::allocate_shared<Session>(RpcSlabAllocator<Session>(),
+                                                                     std::move(socket), *this, nextSessionId_++);
+                        if (trackSessions_) {
+                            LinkSession(session.get());
+                        }
                         session->Start();  // 启动会话
                     }
                     do_accept(); // 继续接受下一个连接
@@ -80,57 +266,468 @@ void RpcProvider::Run() {
         };
         do_accept(); // 在启动线程前调用一次，开始接受连接
 
+        // 粗粒度时钟及空闲连接回收
+        if (trackSessions_) {
+            sweepTimer_.reset(new boost::asio::steady_timer(io_context_, std::chrono::seconds(1)));
+            sweepTimer_->async_wait([this](const boost::system::error_code& ec) {
+                if (!ec) {
+                    SweepSessions();
+                }
+            });
+        }
+
         // === 线程池 ===
         std::vector<std::thread> threads;
-        for (int i = 0; i < 6; ++i) {
+        for (int i = 0; i < kIoThreads; ++i) {
             threads.emplace_back([this]() { io_context_.run(); });  // 运行io_context_.run(), 处理异步事件
         }
 
         for (auto& thread : threads) {
             thread.join();  // 等待所有线程完成
         }
+        // IO线程退出后不再有新请求；尚未执行的请求按过载回复（ShedRpcCall），归还调用上下文及其请求/响应消息
+        // 先中断流式调用，阻塞在 Read / Write 上的流式方法返回后工作线程才能退出
+        CloseLiveStreams();
+        executor_->Stop();
+        streamExecutor_->Stop();
+        // 等待预算回落的会话由恢复回调持有：在 io_context_ 和会话分片仍然存在时释放它们，
+        // 不能留到 memory_ 析构（晚于 io_context_）时才析构会话
+        memory_.DropWaiters();
     } catch (std::exception& e) {
         std::cerr << "RpcProvider::Run exception: " << e.what() << std::endl;
     }
 }
 
+void RpcProvider::Stop() {
+    io_context_.stop();
+}
+
 // Session实现
 void RpcProvider::Session::Start() {
+    // 可读后使用同步的 read_some 读取，套接字需为非阻塞模式（没有数据时返回 would_block 而不是阻塞IO线程）
+    boost::system::error_code ec;
+    socket_.non_blocking(true, ec);
+    if (ec) {
+        return;
+    }
     DoRead();
 }
 
+RpcProvider::Session::~Session() {
+    if (provider_.trackSessions_) {
+        provider_.UnlinkSession(this);
+    }
+    // 未执行的发送回调（如 io_context 停止时）中的响应及未接收完整的请求随会话一起释放
+    int64_t read_bytes = readBytes_.load(std::memory_order_relaxed);
+    int64_t write_bytes = writeBytes_.load(std::memory_order_relaxed);
+    if (read_bytes != 0) {
+        provider_.memory_.Add(RpcMemoryBudget::Kind::Read, -read_bytes);
+    }
+    if (write_bytes != 0) {
+        provider_.memory_.Add(RpcMemoryBudget::Kind::Write, -write_bytes);
+    }
+}
+
+void RpcProvider::Session::Charge(RpcMemoryBudget::Kind kind, int64_t bytes) {
+    std::atomic<int64_t>& held = kind == RpcMemoryBudget::Kind::Read ? readBytes_
+                                 : kind == RpcMemoryBudget::Kind::Call ? callBytes_ : writeBytes_;
+    held.fetch_add(bytes, std::memory_order_relaxed);
+    provider_.memory_.Add(kind, bytes);
+    if (bytes > 0) {
+        provider_.memory_.ObserveSession(MemoryBytes());
+    }
+}
+
+int64_t RpcProvider::Session::MemoryBytes() const {
+    return readBytes_.load(std::memory_order_relaxed) + callBytes_.load(std::memory_order_relaxed) +
+           writeBytes_.load(std::memory_order_relaxed);
+}
+
+void RpcProvider::Session::Close() {
+    std::shared_ptr<RpcProvider::Session> self(shared_from_this());
+    boost::asio::post(socket_.get_executor(), [this, self]() {
+        // 等待中的读操作以 operation_aborted 结束，进行中的写操作失败后丢弃剩余响应
+        boost::system::error_code ignored_ec;
+        socket_.close(ignored_ec);
+        CloseStreams();
+    });
+}
+
+void RpcProvider::Session::AddStream(uint64_t request_id, std::shared_ptr<RpcStream> stream) {
+    std::lock_guard<std::mutex> lock(streamsMutex_);
+    streams_[request_id] = std::move(stream);
+}
+
+void RpcProvider::Session::RemoveStream(uint64_t request_id) {
+    std::lock_guard<std::mutex> lock(streamsMutex_);
+    streams_.erase(request_id);
+}
+
+std::shared_ptr<RpcStream> RpcProvider::Session::FindStream(uint64_t request_id) {
+    std::lock_guard<std::mutex> lock(streamsMutex_);
+    auto it = streams_.find(request_id);
+    return it == streams_.end() ? nullptr : it->second;
+}
+
+void RpcProvider::Session::SetPeer(const RpcHandshake::Capabilities& peer) {
+    peerCompression_.store(peer.compression, std::memory_order_relaxed);
+    peerMaxMessageSize_.store(peer.max_message_size, std::memory_order_relaxed);
+    peerChecksum_.store(peer.checksum, std::memory_order_relaxed);
+}
+
+void RpcProvider::Session::InternMethod(uint32_t index, const MethodRoute& route) {
+    if (index == 0 || index > RpcFrame::kMaxMethodIndex) {
+        return;
+    }
+    if (methods_.size() < index) {
+        methods_.resize(index, MethodRoute{nullptr, nullptr});
+    }
+    methods_[index - 1] = route;
+}
+
+const RpcProvider::MethodRoute* RpcProvider::Session::FindMethod(uint32_t index) const {
+    if (index == 0 || index > methods_.size() || !methods_[index - 1].method_) {
+        return nullptr;
+    }
+    return &methods_[index - 1];
+}
+
+void RpcProvider::Session::CloseStreams() {
+    std::unordered_map<uint64_t, std::shared_ptr<RpcStream>> streams;
+    {
+        std::lock_guard<std::mutex> lock(streamsMutex_);
+        streams.swap(streams_);
+    }
+    for (auto& stream : streams) {
+        stream.second->Close();
+    }
+}
+
 void RpcProvider::Session::DoRead() {
+    static std::atomic<int64_t>& read_pauses = RpcMetrics::GetInstance().Counter("provider.write_backpressure_pauses");
+
+    // 客户端读取响应太慢，未发送的响应达到高水位：暂停读取，不再执行它的新请求，
+    // 写操作完成后回落到低水位以下时由 StartWrite 的回调恢复；暂停期间没有读操作持有会话
+    if (provider_.writeHighWater_ > 0 &&
+        writeBytes_.load(std::memory_order_relaxed) >= static_cast<int64_t>(provider_.writeHighWater_)) {
+        readPaused_ = true;
+        read_pauses.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
     std::shared_ptr<RpcProvider::Session> self(shared_from_this());  // 获取shared_ptr指向当前对象的指针，保证对象在异步操作期间存活！
-    buffer_.resize(4096);  // 调整缓冲区大小
-
-    socket_.async_read_some(    // 异步读取数据，不会阻塞，当有数据到达时调用回调函数
-        boost::asio::buffer(buffer_),
-        [this, self](boost::system::error_code ec, std::size_t length) {
-            if (!ec) {
-                std::string request_data(buffer_.data(), length);   
-                provider_.HandleRequest(self, request_data); // 处理请求
+
+    // 服务端内存超过预算：暂停读取，不再接收新请求，内存回落后在 strand 中恢复；
+    // 已收到部分数据的请求继续接收，它们完成后才能释放内存，暂停它们可能使所有会话都无法继续
+    if (provider_.memory_.Exceeded() && pending_.empty() && chunks_.Bytes() == 0) {
+        provider_.memory_.WaitBelow([this, self]() {
+            boost::asio::post(socket_.get_executor(), [this, self]() { DoRead(); });
+        });
+        return;
+    }
+
+    // 先等待套接字可读，等待期间不占用读缓冲区；登记等待时 asio 会重新检查可读状态，已到达的数据不会被遗漏
+    socket_.async_wait(
+        boost::asio::ip::tcp::socket::wait_read,
+        // 回调内存取自会话的 readMemory_：连续的读操作复用同一块内存
+        MakeAllocHandler(readMemory_, [this, self](boost::system::error_code ec) {
+            if (ec) {
+                CloseStreams();
+                return; // 连接关闭或出错，不再读取；尚未完成的请求持有 self，完成后会话自动释放
             }
-        }
+            if (ReadAvailable()) {
+                DoRead();   // 继续读取下一个请求
+            }
+        })
     );
 }
 
-void RpcProvider::Session::DoWrite(const std::string& response) {
+bool RpcProvider::Session::ReadAvailable() {
+    // 可读时才从缓冲区池取出缓冲区，处理完本次读到的请求后归还
+    RpcBufferPool::Buffer buffer = RpcBufferPool::Acquire(RpcBufferPool::ClassSize(readClass_));
+    boost::system::error_code ec;
+    size_t length = socket_.read_some(boost::asio::buffer(buffer.data(), buffer.size()), ec);
+    if (ec == boost::asio::error::would_block) {
+        return true;    // 可读通知之后数据已被读走，继续等待
+    }
+    if (ec) {
+        CloseStreams();
+        return false;
+    }
+    Touch();
+    // 读满时下次使用更大一级的缓冲区，读到的数据不足四分之一时降一级
+    if (length == buffer.size() && readClass_ < RpcBufferPool::kClasses - 1) {
+        ++readClass_;
+    } else if (length <= buffer.size() / 4 && readClass_ > 0) {
+        --readClass_;
+    }
+
+    // 一次读取可能包含多个请求，也可能只包含请求的一部分
+    bool ok = true;
+    size_t offset = 0;
+    if (pending_.empty()) {
+        // 没有未完成的请求：直接从读缓冲区处理，只把末尾不完整的请求复制到 pending_
+        ok = HandleData(buffer.data(), length, &offset);
+        if (ok && offset < length) {
+            pending_.assign(buffer.data() + offset, length - offset);
+        }
+    } else {
+        pending_.append(buffer.data(), length);
+        ok = HandleData(pending_.data(), pending_.size(), &offset);
+        pending_.erase(0, offset);
+        if (pending_.empty()) {
+            std::string().swap(pending_);   // 请求已接收完整，释放为其分配的内存
+        }
+    }
+    UpdateReadBytes();
+    if (!ok) {
+        // 请求格式错误，无法再确定后续请求的边界，关闭连接
+        boost::system::error_code ignored_ec;
+        socket_.close(ignored_ec);
+        CloseStreams();
+        return false;
+    }
+    return true;
+}
+
+void RpcProvider::Session::UpdateReadBytes() {
+    int64_t bytes = static_cast<int64_t>(pending_.size() + chunks_.Bytes());
+    int64_t delta = bytes - readBytes_.load(std::memory_order_relaxed);
+    if (delta != 0) {
+        Charge(RpcMemoryBudget::Kind::Read, delta);
+    }
+}
+
+bool RpcProvider::Session::HandleData(const char* data, size_t size, size_t* consumed) {
+    std::shared_ptr<RpcProvider::Session> self(shared_from_this());
+    size_t offset = 0;
+    while (offset < size) {
+        size_t length = 0;
+        if (!provider_.HandleRequest(self, data + offset, size - offset, &length)) {
+            *consumed = offset;
+            return false;
+        }
+        if (length == 0) {
+            break;  // 剩余数据不足一个完整请求，等待后续数据
+        }
+        offset += length;
+    }
+    *consumed = offset;
+    return true;
+}
+
+void RpcProvider::Session::DoWrite(std::string response) {
     std::shared_ptr<RpcProvider::Session> self(shared_from_this());  // 获取shared_ptr指向当前对象的指针，保证对象在异步操作期间存活！
 
+    // 校验和在产生响应的线程中计算，不占用连接的 strand
+    if (provider_.checksum_ && peerChecksum_.load(std::memory_order_relaxed)) {
+        RpcChecksum::Seal(&response);
+    }
+    Charge(RpcMemoryBudget::Kind::Write, static_cast<int64_t>(response.size()));
+
+    // 响应可能由任意工作线程产生，投递到该连接的 strand 中排队，保证同一时刻只有一个 async_write
+    boost::asio::post(socket_.get_executor(), [this, self, response = std::move(response)]() mutable {
+        writeQueue_.push_back(std::move(response));
+        if (!writeActive_) {
+            StartWrite();
+        }
+    });
+}
+
+void RpcProvider::Session::DoWriteChunked(std::unique_ptr<ChunkedFrame> frame) {
+    std::shared_ptr<RpcProvider::Session> self(shared_from_this());
+
+    if (provider_.checksum_ && peerChecksum_.load(std::memory_order_relaxed)) {
+        frame->EnableChecksum();
+    }
+    Charge(RpcMemoryBudget::Kind::Write, static_cast<int64_t>(frame->Size()));
+    boost::asio::post(socket_.get_executor(), [this, self, frame = std::move(frame)]() mutable {
+        chunkedQueue_.push_back(std::move(frame));
+        if (!writeActive_) {
+            StartWrite();
+        }
+    });
+}
+
+/**
+ * @brief 一组连续存放的缓冲区的视图（满足 ConstBufferSequence），复制时不复制缓冲区数组
+ */
+struct BufferView {
+    const boost::asio::const_buffer* begin() const { return begin_; }
+    const boost::asio::const_buffer* end() const { return end_; }
+
+    const boost::asio::const_buffer* begin_;
+    const boost::asio::const_buffer* end_;
+};
+
+void RpcProvider::Session::StartWrite() {
+    static std::atomic<int64_t>& write_calls = RpcMetrics::GetInstance().Counter("provider.write_calls");
+    static std::atomic<int64_t>& write_responses = RpcMetrics::GetInstance().Counter("provider.write_responses");
+
+    std::shared_ptr<RpcProvider::Session> self(shared_from_this());
+
+    // 上一次写操作期间就绪的响应全部取出，一次写出；未开启合并发送时每次只写一个
+    size_t count = provider_.writeCoalescing_ ? writeQueue_.size() : std::min<size_t>(writeQueue_.size(), 1);
+    for (size_t i = 0; i < count; ++i) {
+        writing_.push_back(std::move(writeQueue_.front()));
+        writeQueue_.pop_front();
+    }
+    // writing_ 填充完毕后再取缓冲区地址（vector 扩容会移动其中的 string）
+    writeBuffers_.clear();
+    writingBytes_ = 0;
+    for (const std::string& response : writing_) {
+        writeBuffers_.push_back(boost::asio::buffer(response));
+        writingBytes_ += static_cast<int64_t>(response.size());
+    }
+    // 每次最多附带一个分块，大响应之间轮流发送，小响应不会排在整个大响应之后
+    bool last_chunk = false;
+    if (!chunkedQueue_.empty() && (provider_.writeCoalescing_ || count == 0)) {
+        chunkedWriting_ = std::move(chunkedQueue_.front());
+        chunkedQueue_.pop_front();
+        last_chunk = chunkedWriting_->Next(&writeBuffers_);
+        if (last_chunk) {
+            writingBytes_ += static_cast<int64_t>(chunkedWriting_->Size());  // 大响应发送完最终帧后才释放
+        }
+        ++count;
+    }
+    write_calls.fetch_add(1, std::memory_order_relaxed);
+    write_responses.fetch_add(count, std::memory_order_relaxed);
+    writeActive_ = true;
+
     boost::asio::async_write(
         socket_,
-        boost::asio::buffer(response),
-        [this, self](boost::system::error_code ec, std::size_t /*length*/) {
-            if (!ec) {
-                // 关闭连接
+        // writing_、chunkedWriting_ 及 writeBuffers_ 在发送完成前不会被修改，缓冲区保持有效；
+        // 传入视图而不是 vector，async_write 不再复制缓冲区数组
+        BufferView{writeBuffers_.data(), writeBuffers_.data() + writeBuffers_.size()},
+        MakeAllocHandler(writeMemory_, [this, self, last_chunk](boost::system::error_code ec, std::size_t /*length*/) {
+            writing_.clear();
+            writeActive_ = false;
+            int64_t released = writingBytes_;
+            if (ec) {
+                // 发送失败，丢弃剩余响应并关闭连接
+                for (const std::string& response : writeQueue_) {
+                    released += static_cast<int64_t>(response.size());
+                }
+                for (const std::unique_ptr<ChunkedFrame>& frame : chunkedQueue_) {
+                    released += static_cast<int64_t>(frame->Size());
+                }
+                if (chunkedWriting_ && !last_chunk) {
+                    released += static_cast<int64_t>(chunkedWriting_->Size());
+                }
+                Charge(RpcMemoryBudget::Kind::Write, -released);
+                writeQueue_.clear();
+                chunkedQueue_.clear();
+                chunkedWriting_.reset();
                 boost::system::error_code ignored_ec;   // 忽略错误码
-                socket_.shutdown(boost::asio::ip::tcp::socket::shutdown_both, ignored_ec);
+                socket_.close(ignored_ec);
+                CloseStreams();
+                return;
             }
-        }
+            Charge(RpcMemoryBudget::Kind::Write, -released);
+            Touch();
+            if (readPaused_ && writeBytes_.load(std::memory_order_relaxed) < static_cast<int64_t>(provider_.writeLowWater_)) {
+                readPaused_ = false;
+                DoRead();
+            }
+            if (chunkedWriting_ && !last_chunk) {
+                chunkedQueue_.push_back(std::move(chunkedWriting_));
+            }
+            chunkedWriting_.reset();
+            if (!writeQueue_.empty() || !chunkedQueue_.empty()) {
+                StartWrite();
+            }
+        })
     );
 }
 
-void RpcProvider::HandleRequest(std::shared_ptr<Session> session, const std::string& request_data) {
+/**
+ * @brief 从字符流中解码一个请求：数据头（两种格式见 rpcframe.h）+ 请求参数 [+ 4字节校验和]
+ * @param data 字符流
+ * @param size 字符流长度
+ * @param max_args_size 请求参数长度上限
+ * @param header 输出参数，请求的数据头
+ * @param args 输出参数，请求参数的起始位置
+ * @param consumed 输出参数，请求的总长度，数据不足一个完整请求时为 0
+ * @param fixed 输出参数，请求是否使用定长数据头
+ * @return 请求格式错误或校验和不一致时返回 false
+ */
+static bool DecodeRequest(const char* data, size_t size, size_t max_args_size, rpcheader::RpcHeader* header,
+                          const char** args, size_t* consumed, bool* fixed) {
+    static std::atomic<int64_t>& checksum_errors = RpcMetrics::GetInstance().Counter("provider.checksum_errors");
+    *consumed = 0;
+
+    RpcFrame::FrameInfo info;
+    switch (RpcFrame::ParseRequestHeader(data, size, header, &info)) {
+        case RpcFrame::Result::kIncomplete:
+            return true;    // 数据头还未接收完整
+        case RpcFrame::Result::kError:
+            std::cerr << "RpcProvider::HandleRequest invalid request header!" << std::endl;
+            return false;
+        case RpcFrame::Result::kOk:
+            break;
+    }
+    if (header->args_size() > max_args_size) {
+        // 不等待参数接收完整就关闭连接，避免为超长的请求缓存数据
+        std::cerr << "RpcProvider::HandleRequest args_size " << header->args_size() << " exceeds max message size" << std::endl;
+        return false;
+    }
+    size_t frame_size = info.header_bytes + header->args_size() + (info.checksum ? 4 : 0);
+    if (size < frame_size) {
+        return true;    // 请求参数还未接收完整
+    }
+    // 校验和不一致说明帧在传输中损坏，帧边界也不再可信，关闭连接
+    if (info.checksum && !RpcChecksum::Verify(data, frame_size)) {
+        checksum_errors.fetch_add(1, std::memory_order_relaxed);
+        std::cerr << "RpcProvider::HandleRequest frame checksum mismatch!" << std::endl;
+        return false;
+    }
+    *args = data + info.header_bytes;
+    *consumed = frame_size;
+    *fixed = info.fixed;
+    return true;
+}
+
+/**
+ * @brief 编码响应数据头
+ * @param header 响应数据头
+ * @param fixed 是否使用定长数据头
+ * @return 编码结果，消息体由调用方追加
+ */
+static std::string EncodeResponseHeader(const rpcheader::RpcResponseHeader& header, bool fixed) {
+    std::string frame;
+    RpcFrame::AppendResponseHeader(header, fixed, &frame);
+    return frame;
+}
+
+/**
+ * @brief 组装流式调用中服务端发送的帧：响应数据头 + 消息体
+ * @param type 帧类型（流中的消息或授信）
+ * @param request_id 流式调用的请求id
+ * @param credit 授信帧中追加的额度
+ * @param body 消息体
+ * @param fixed 是否使用定长数据头
+ * @return 帧
+ */
+static std::string BuildStreamFrame(rpcheader::FrameType type, uint64_t request_id, uint32_t credit,
+                                    const std::string& body, bool fixed) {
+    rpcheader::RpcResponseHeader header;
+    header.set_status(rpcheader::RPC_OK);
+    header.set_frame_type(type);
+    header.set_request_id(request_id);
+    header.set_credit(credit);
+    header.set_body_size(body.size());
+
+    std::string frame;
+    frame.reserve(RpcFrame::kFixedHeaderSize + 16 + body.size());
+    RpcFrame::AppendResponseHeader(header, fixed, &frame);
+    frame.append(body);
+    return frame;
+}
+
+bool RpcProvider::HandleRequest(std::shared_ptr<Session> session, const char* data, size_t size, size_t* consumed) {
+    static std::atomic<int64_t>& handshakes = RpcMetrics::GetInstance().Counter("provider.handshakes");
+    static std::atomic<int64_t>& stream_resets = RpcMetrics::GetInstance().Counter("provider.stream_flow_control_errors");
+
     /**
      * @note 第一步：读取远程 rpc调用请求的字符流
      * 
@@ -139,110 +736,851 @@ void RpcProvider::HandleRequest(std::shared_ptr<Session> session, const std::str
      * 2.数据头 rpc_header_str
      * 3.请求参数 args_str
      */
+    rpcheader::RpcHeader rpcHeader;
+    const char* args = nullptr;
+    bool fixed = false;
+    if (!DecodeRequest(data, size, maxMessageSize_, &rpcHeader, &args, consumed, &fixed)) {
+        return false;
+    }
+    if (*consumed == 0) {
+        return true;    // 请求还未接收完整
+    }
 
-    // 从字符流中读取数据头的长度信息
-    uint32_t header_size = 0;
-    request_data.copy((char*)&header_size, 4, 0);
-    header_size = ntohl(header_size);  // 网络字节序转主机字节序
+    // 大请求的一个分块：挂到该请求的缓冲区链上，收到最终帧后再处理
+    if (rpcHeader.frame_type() == rpcheader::FRAME_CHUNK) {
+        session->Chunks().AddChunk(rpcHeader.request_id(), args, rpcHeader.args_size());
+        return true;
+    }
 
-    // 根据header_size读取数据头字符串,并反序列化数据
-    std::string rpc_header_str = request_data.substr(4, header_size);
-    rpcheader::RpcHeader rpcHeader;
-    if (rpcHeader.ParseFromString(rpc_header_str)) {   // 数据头反序列化成功
-        // 获取反序列化结果
-        std::string service_name = rpcHeader.service_name();   // 获取服务名称
-        std::string method_name = rpcHeader.method_name();     // 获取方法名称
-        uint32_t args_size = rpcHeader.args_size();           // 获取参数长度
+    // 握手：记录客户端的能力并回复本端的能力，之后发给该客户端的帧按其能力启用压缩和校验和
+    if (rpcHeader.frame_type() == rpcheader::FRAME_HANDSHAKE) {
+        RpcHandshake::Capabilities peer;
+        if (!RpcHandshake::Parse(args, rpcHeader.args_size(), &peer)) {
+            std::cerr << "RpcProvider::HandleRequest invalid handshake!" << std::endl;
+            return false;
+        }
+        handshakes.fetch_add(1, std::memory_order_relaxed);
+        session->SetPeer(peer);
+        RpcHandshake::Capabilities local = RpcHandshake::Local(maxMessageSize_);
+        local.ambiguous_method_ids = ambiguousMethodIds_;
+        session->DoWrite(RpcHandshake::BuildResponse(local));
+        return true;
+    }
 
-        // 获取args_str参数字符串
-        std::string args_str = request_data.substr(4 + header_size, args_size);
+    // 进行中的流式调用：客户端追加授信、发送消息或结束发送；流已结束（或调用被拒绝）时丢弃
+    if (rpcHeader.frame_type() != rpcheader::FRAME_UNARY) {
+        std::shared_ptr<RpcStream> stream = session->FindStream(rpcHeader.request_id());
+        if (!stream) {
+            return true;
+        }
+        switch (rpcHeader.frame_type()) {
+            case rpcheader::FRAME_STREAM_CREDIT:
+                stream->OnCredit(rpcHeader.credit());
+                break;
+            case rpcheader::FRAME_STREAM_MESSAGE:
+                if (!stream->OnMessage(std::string(args, rpcHeader.args_size()))) {
+                    // 客户端超出授信窗口：中断流，服务方法结束后以 RPC_BAD_REQUEST 回复
+                    stream_resets.fetch_add(1, std::memory_order_relaxed);
+                    session->RemoveStream(rpcHeader.request_id());
+                    stream->Close();
+                }
+                break;
+            case rpcheader::FRAME_STREAM_END:
+                stream->OnEnd();
+                break;
+            case rpcheader::FRAME_STREAM_RESET:
+                // 客户端中止流：中断流，服务方法结束后的最终响应被客户端丢弃
+                session->RemoveStream(rpcHeader.request_id());
+                stream->Close();
+                break;
+            default:
+                break;
+        }
+        return true;
+    }
 
-        std::cout << "RpcProvider::HandleRequest receive rpc request: "
-                  << "service_name=" << service_name
-                  << " method_name=" << method_name
-                  << " args_size=" << args_size 
-                  << " args:" << args_str << std::endl;
+    ReplyTarget reply{session, nullptr, 0, rpcHeader.one_way(), fixed};
+    BufferChain chain;
+    switch (session->Chunks().Finish(rpcHeader.request_id(), args, rpcHeader.args_size(), &chain)) {
+        case ChunkAssembler::Result::kTooLarge:
+            SendRpcError(reply, rpcHeader.request_id(), rpcheader::RPC_BAD_REQUEST, "request exceeds max message size");
+            return true;
+        case ChunkAssembler::Result::kAssembled:
+            if (rpcHeader.batch_count() > 0) {
+                SendRpcError(reply, rpcHeader.request_id(), rpcheader::RPC_BAD_REQUEST, "chunked batch request");
+                return true;
+            }
+            DispatchRequest(reply, rpcHeader, nullptr, 0, &chain);
+            return true;
+        case ChunkAssembler::Result::kSingle:
+            break;
+    }
 
-        /**
-         * @note 第二步：根据 rpc 请求，查找注册的服务对象以及相应的方法
-         */
-        // 获取service和method
+    if (rpcHeader.batch_count() > 0) {
+        return HandleBatchRequest(session, rpcHeader, args, rpcHeader.args_size());
+    }
+    DispatchRequest(reply, rpcHeader, args, rpcHeader.args_size());
+    return true;
+}
+
+bool RpcProvider::HandleBatchRequest(std::shared_ptr<Session> session, const rpcheader::RpcHeader& header,
+                                     const char* args, size_t args_size) {
+    static std::atomic<int64_t>& batch_requests = RpcMetrics::GetInstance().Counter("provider.batch_requests");
+    static std::atomic<int64_t>& batch_items = RpcMetrics::GetInstance().Counter("provider.batch_items");
+
+    // 每个子请求至少包含4字节的 header_size，据此拒绝子请求数不合理的批量请求
+    if (header.batch_count() > args_size / 4) {
+        std::cerr << "RpcProvider::HandleBatchRequest invalid batch_count " << header.batch_count() << std::endl;
+        return false;
+    }
+
+    // 先解码全部子请求，格式错误时不投递任何子请求，否则批量响应永远无法凑齐
+    std::vector<rpcheader::RpcHeader> headers(header.batch_count());
+    std::vector<const char*> items(header.batch_count());
+    size_t offset = 0;
+    for (uint32_t i = 0; i < header.batch_count(); ++i) {
+        size_t consumed = 0;
+        bool fixed = false;     // 子响应总是使用 protobuf 数据头，与子请求的格式无关
+        if (!DecodeRequest(args + offset, args_size - offset, maxMessageSize_, &headers[i], &items[i], &consumed, &fixed)) {
+            return false;
+        }
+        if (consumed == 0) {
+            std::cerr << "RpcProvider::HandleBatchRequest truncated batch item " << i << std::endl;
+            return false;
+        }
+        offset += consumed;
+    }
+    if (offset != args_size) {
+        std::cerr << "RpcProvider::HandleBatchRequest batch size mismatch" << std::endl;
+        return false;
+    }
+    batch_requests.fetch_add(1, std::memory_order_relaxed);
+    batch_items.fetch_add(header.batch_count(), std::memory_order_relaxed);
+
+    auto batch = std::make_shared<BatchContext>();
+    batch->session_ = session;
+    batch->request_id_ = header.request_id();
+    batch->responses_.resize(header.batch_count());
+    batch->remaining_ = header.batch_count();
+
+    // 子请求各自调度执行，子请求没有携带租户标识时沿用批量请求的租户
+    for (uint32_t i = 0; i < header.batch_count(); ++i) {
+        ReplyTarget reply{session, batch, i};
+        if (headers[i].batch_count() > 0) {
+            SendRpcError(reply, headers[i].request_id(), rpcheader::RPC_BAD_REQUEST, "nested batch request");
+            continue;
+        }
+        if (headers[i].tenant().empty()) {
+            headers[i].set_tenant(header.tenant());
+        }
+        DispatchRequest(reply, headers[i], items[i], headers[i].args_size());
+    }
+    return true;
+}
+
+void RpcProvider::DispatchRequest(const ReplyTarget& reply, rpcheader::RpcHeader& rpcHeader,
+                                  const char* args, size_t args_size, const BufferChain* chain) {
+    // 获取反序列化结果
+    uint64_t request_id = rpcHeader.request_id();                 // 获取请求id
+
+    std::cout << "RpcProvider::HandleRequest receive rpc request: ";
+    if (rpcHeader.method_id() != 0) {
+        std::cout << "method_id=" << rpcHeader.method_id();
+    } else if (rpcHeader.service_name().empty() && rpcHeader.method_index() != 0) {
+        std::cout << "method_index=" << rpcHeader.method_index();
+    } else {
+        std::cout << "service_name=" << rpcHeader.service_name() << " method_name=" << rpcHeader.method_name();
+    }
+    std::cout << " args_size=" << (chain ? chain->Size() : args_size)
+              << " args:" << (chain ? std::string("<chunked>") : std::string(args, args_size)) << std::endl;
+
+    /**
+     * @note 第二步：根据 rpc 请求，查找注册的服务对象以及相应的方法
+     *       定长数据头的请求按方法id查找，protobuf 数据头的请求按服务名和方法名查找，
+     *       只带连接内序号的请求按该连接上登记的序号查找
+     */
+    ServiceInfo* serviceInfo = nullptr;
+    MethodInfo* methodInfo = nullptr;
+    if (rpcHeader.method_id() != 0) {
+        auto it = methodIds_.find(rpcHeader.method_id());
+        if (it == methodIds_.end() || !it->second.method_) {
+            std::cerr << "RpcProvider::HandleRequest method id " << rpcHeader.method_id() << " not found!" << std::endl;
+            SendRpcError(reply, request_id, rpcheader::RPC_METHOD_NOT_FOUND,
+                         "method id " + std::to_string(rpcHeader.method_id()) + " not found");
+            return;
+        }
+        serviceInfo = it->second.service_;
+        methodInfo = it->second.method_;
+    } else if (rpcHeader.service_name().empty() && rpcHeader.method_index() != 0) {
+        const MethodRoute* route = reply.session_->FindMethod(rpcHeader.method_index());
+        if (!route) {
+            std::cerr << "RpcProvider::HandleRequest method index " << rpcHeader.method_index() << " not defined!" << std::endl;
+            SendRpcError(reply, request_id, rpcheader::RPC_METHOD_NOT_FOUND,
+                         "method index " + std::to_string(rpcHeader.method_index()) + " not defined");
+            return;
+        }
+        serviceInfo = route->service_;
+        methodInfo = route->method_;
+    } else {
+        const std::string& service_name = rpcHeader.service_name();   // 获取服务名称
+        const std::string& method_name = rpcHeader.method_name();     // 获取方法名称
         auto sit = serviceMap_.find(service_name); // 查找服务是否存在
         if (sit == serviceMap_.end()) {
             std::cerr << "RpcProvider::HandleRequest service " << service_name << " not found!" << std::endl;
+            SendRpcError(reply, request_id, rpcheader::RPC_SERVICE_NOT_FOUND, "service " + service_name + " not found");
             return;
         }
-        ServiceInfo serviceInfo = sit->second; // 获取服务信息结构体
-        auto mit = serviceInfo.methodMap_.find(method_name); // 查找方法是否存在
-        if (mit == serviceInfo.methodMap_.end()) {
+        serviceInfo = &sit->second; // 获取服务信息结构体
+        auto mit = serviceInfo->methodMap_.find(method_name); // 查找方法是否存在
+        if (mit == serviceInfo->methodMap_.end()) {
             std::cerr << "RpcProvider::HandleRequest method " << method_name << " not found!" << std::endl;
+            SendRpcError(reply, request_id, rpcheader::RPC_METHOD_NOT_FOUND, "method " + method_name + " not found");
             return;
         }
+        methodInfo = &mit->second;
+        // 客户端同时发送了序号：登记后，之后的请求可以只带序号
+        if (rpcHeader.method_index() != 0) {
+            reply.session_->InternMethod(rpcHeader.method_index(), MethodRoute{serviceInfo, methodInfo});
+        }
+    }
 
-        // 服务对象
-        google::protobuf::Service* service = serviceInfo.service_;
-        // 服务对象的方法描述符
-        const google::protobuf::MethodDescriptor* method = mit->second;
+    // 服务对象
+    google::protobuf::Service* service = serviceInfo->service_;
+    // 服务对象的方法信息及方法描述符
+    const google::protobuf::MethodDescriptor* method = methodInfo->method_;
+    if (methodInfo->streaming_ && reply.batch_) {
+        SendRpcError(reply, request_id, rpcheader::RPC_BAD_REQUEST, "streaming method in batch request");
+        return;
+    }
 
-        /**
-         * @note 第三步：反序列化参数，调用方法，获取响应结果
-         */
-        // 创建请求request和响应response消息对象
-        google::protobuf::Message *request = service->GetRequestPrototype(method).New(); // 创建请求对象
-        if (!request->ParseFromString(args_str)) {  // 反序列化请求参数
-            std::cerr << "RpcProvider::HandleRequest parse request args_str error!" << std::endl;
-            delete request;
-            return;
-        }
-        google::protobuf::Message *response = service->GetResponsePrototype(method).New();  // 创建响应对象
+    // 自适应限流：先占用服务级名额，再占用方法级名额，超过上限的请求立即以 server busy 拒绝，不再排队
+    if (serverLimiter_ && !serverLimiter_->TryAcquire()) {
+        SendRpcError(reply, request_id, rpcheader::RPC_SERVER_BUSY, "server busy");
+        return;
+    }
+    if (methodInfo->limiter_ && !methodInfo->limiter_->TryAcquire()) {
+        serverLimiter_->Cancel();
+        SendRpcError(reply, request_id, rpcheader::RPC_SERVER_BUSY, "server busy: " + method->service()->name() + "." + method->name());
+        return;
+    }
+    auto start = std::chrono::steady_clock::now();
 
-        // 创建回调对象，用于处理rpc方法调用完成后的响应发送
-        google::protobuf::Closure* done = google::protobuf::NewCallback<RpcProvider,
-                                                                         std::shared_ptr<Session>,
-                                                                         google::protobuf::Message*>(
-            this,
-            &RpcProvider::SendRpcResponse,
-            session,
-            response
-        );
+    /**
+     * @note 第三步：反序列化参数，调用方法，获取响应结果
+     */
+    // 创建请求request和响应response消息对象
+    google::protobuf::Message *request = NewMessage(methodInfo->requestPool_.get(), service->GetRequestPrototype(method)); // 创建请求对象
+    size_t request_bytes = rpcHeader.compression() != rpcheader::COMPRESS_NONE ? rpcHeader.uncompressed_size()
+                           : chain ? chain->Size() : args_size;
+    bool parsed = false;
+    if (rpcHeader.compression() != rpcheader::COMPRESS_NONE) {
+        // 压缩的请求参数先解压到连续内存；解压后的长度同样受最大消息长度限制
+        std::string compressed;
+        if (chain) {
+            chain->Flatten(&compressed);
+            args = compressed.data();
+            args_size = compressed.size();
+        }
+        std::string plain;
+        parsed = rpcHeader.uncompressed_size() <= maxMessageSize_ &&
+                 RpcCompressor::GetInstance().Decompress(rpcHeader.compression(), args, args_size,
+                                                         rpcHeader.uncompressed_size(), &plain) &&
+                 request->ParseFromArray(plain.data(), plain.size());
+    } else {
+        parsed = chain ? chain->ParseTo(request) : request->ParseFromArray(args, args_size);
+    }
+    if (!parsed) {  // 反序列化请求参数
+        std::cerr << "RpcProvider::HandleRequest parse request args_str error!" << std::endl;
+        if (serverLimiter_) {
+            serverLimiter_->Cancel();
+            methodInfo->limiter_->Cancel();
+        }
+        DeleteMessage(methodInfo->requestPool_.get(), request, request_bytes);
+        SendRpcError(reply, request_id, rpcheader::RPC_BAD_REQUEST, "parse request args error");
+        return;
+    }
+    google::protobuf::Message *response = NewMessage(methodInfo->responsePool_.get(), service->GetResponsePrototype(method));  // 创建响应对象
 
-        // === 在框架上根据远程 rpc 调用请求，调用服务对象的方法 === 
-        // protobuf会根据method描述符，调用对应的服务方法,并传入request、response、done参数,最终填充好response对象，并调用done回调
-        service->CallMethod(method, nullptr, request, response, done);
-        
-        // 释放request内存
-        delete request;
+    // 解码完成，投递到工作线程池执行；投递时刻即为排队时间（sojourn）的起点
+    // 按租户公平调度，未携带租户标识的请求按连接调度
+    CallContext* call = new CallContext{reply, request_id, service, request, response, methodInfo, start, {}};
+    call->requestBytes_ = request_bytes;
+    // 请求在执行完成前计入会话和方法持有的内存，ReleaseCall 时归还
+    reply.session_->Charge(RpcMemoryBudget::Kind::Call, static_cast<int64_t>(request_bytes));
+    reply.session_->AddCalls(1);
+    methodInfo->memoryBytes_->fetch_add(static_cast<int64_t>(request_bytes), std::memory_order_relaxed);
+    if (rpcHeader.timeout_ms() > 0) {
+        call->deadline_ = start + std::chrono::milliseconds(rpcHeader.timeout_ms());
+    }
+    // 元数据整块移入控制器，服务方法通过 GetMetadata 读取指向其中的 string_view，不为每个 key 分配内存
+    if (!rpcHeader.metadata().empty() &&
+        !call->controller_.SetIncomingMetadata(std::move(*rpcHeader.mutable_metadata()))) {
+        std::cerr << "RpcProvider::HandleRequest parse request metadata error!" << std::endl;
+        ShedRpcCall(call, rpcheader::RPC_BAD_REQUEST, "parse request metadata error");
+        return;
+    }
+    if (methodInfo->streaming_) {
+        // 流式方法通过 controller->GetStream() 收发消息，发送额度来自对端的授信
+        std::shared_ptr<Session> session = reply.session_;
+        bool fixed = reply.fixed_;
+        RpcStream::MessageSender send_message;
+        if (methodInfo->serverStreaming_) {
+            send_message = [session, request_id, fixed](std::string message) {
+                session->DoWrite(BuildStreamFrame(rpcheader::FRAME_STREAM_MESSAGE, request_id, 0, message, fixed));
+            };
+        }
+        RpcStream::CreditSender send_credit;
+        if (methodInfo->clientStreaming_) {
+            send_credit = [session, request_id, fixed](uint32_t credit) {
+                session->DoWrite(BuildStreamFrame(rpcheader::FRAME_STREAM_CREDIT, request_id, credit, "", fixed));
+            };
+        }
+        auto stream = std::make_shared<RpcStream>(streamWindow_, std::move(send_message), std::move(send_credit));
+        stream->OnCredit(rpcHeader.credit());
+        session->AddStream(request_id, stream);
+        TrackStream(stream);
+        if (methodInfo->clientStreaming_) {
+            // 先注册流再授信，客户端的消息到达时一定能找到流
+            session->DoWrite(BuildStreamFrame(rpcheader::FRAME_STREAM_CREDIT, request_id, streamWindow_, "", fixed));
+        }
+        call->controller_.SetStream(stream);
+    }
+    if (methodInfo->batcher_) {
+        EnqueueBatchCall(call);
+        return;
+    }
+    // 流标识写入线程复用的缓冲区，每个请求不再分配字符串（执行器按它查找已有的流）
+    static thread_local std::string flow;
+    if (rpcHeader.tenant().empty()) {
+        flow.assign("conn:");
+        flow.append(std::to_string(reply.session_->GetId()));
     } else {
-        std::cerr << "RpcProvider::HandleRequest parse rpc_header_str error!" << std::endl;
+        flow.assign("tenant:");
+        flow.append(rpcHeader.tenant());
+    }
+    // 流式方法在独立的线程池中执行，阻塞在 Read / Write 上时不占用一元调用的工作线程
+    RpcExecutor* executor = methodInfo->streaming_ ? streamExecutor_.get() : executor_.get();
+    executor->Submit(
+        methodInfo->priority_,
+        flow,
+        [this, call]() { CallServiceMethod(call); },
+        [this, call]() { ShedRpcCall(call, rpcheader::RPC_OVERLOADED, "request shed: queued too long"); }
+    );
+}
+
+void RpcProvider::CallServiceMethod(CallContext* call) {
+    static std::atomic<int64_t>& deadline_exceeded = RpcMetrics::GetInstance().Counter("provider.deadline_exceeded");
+
+    // 排队期间已超过客户端的截止时间，客户端不再等待结果，不执行
+    if (std::chrono::steady_clock::now() >= call->deadline_) {
+        deadline_exceeded.fetch_add(1, std::memory_order_relaxed);
+        ShedRpcCall(call, rpcheader::RPC_DEADLINE_EXCEEDED, "deadline exceeded");
         return;
-     }
+    }
+
+    // done 回调可能在 CallMethod 返回前就释放了 call，先取出 request
+    google::protobuf::Message* request = call->request_;
+    RpcMessagePool* request_pool = call->methodInfo_->requestPool_.get();
+    size_t request_bytes = call->requestBytes_;
+
+    // 创建回调对象，用于处理rpc方法调用完成后的响应发送
+    google::protobuf::Closure* done = google::protobuf::NewCallback<RpcProvider, CallContext*>(
+        this,
+        &RpcProvider::SendRpcResponse,
+        call
+    );
+
+    // === 在框架上根据远程 rpc 调用请求，调用服务对象的方法 === 
+    // protobuf会根据method描述符，调用对应的服务方法,并传入request、response、done参数,最终填充好response对象，并调用done回调
+    call->service_->CallMethod(call->methodInfo_->method_, &call->controller_, request, call->response_, done);
+
+    // 释放request内存
+    DeleteMessage(request_pool, request, request_bytes);
+}
+
+void RpcProvider::EnqueueBatchCall(CallContext* call) {
+    MethodBatcher* batcher = call->methodInfo_->batcher_.get();
+    std::vector<CallContext*>* calls = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(batcher->mutex_);
+        batcher->calls_.push_back(call);
+        if (batcher->calls_.size() >= batcher->maxItems_) {
+            // 攒满一批，立即投递，并让已启动的定时器失效
+            calls = new std::vector<CallContext*>(std::move(batcher->calls_));
+            batcher->calls_.clear();
+            ++batcher->generation_;
+            batcher->timer_.cancel();
+        } else if (batcher->calls_.size() == 1) {
+            // 一批中的第一个请求，最多等待 maxDelay_
+            uint64_t generation = batcher->generation_;
+            batcher->timer_.expires_after(batcher->maxDelay_);
+            batcher->timer_.async_wait([this, batcher, generation](const boost::system::error_code&) {
+                std::vector<CallContext*>* calls = nullptr;
+                {
+                    std::lock_guard<std::mutex> lock(batcher->mutex_);
+                    if (batcher->generation_ != generation || batcher->calls_.empty()) {
+                        return;     // 这一批已经因攒满而投递
+                    }
+                    calls = new std::vector<CallContext*>(std::move(batcher->calls_));
+                    batcher->calls_.clear();
+                    ++batcher->generation_;
+                }
+                SubmitBatch(calls);
+            });
+        }
+    }
+    if (calls) {
+        SubmitBatch(calls);
+    }
+}
+
+void RpcProvider::SubmitBatch(std::vector<CallContext*>* calls) {
+    static std::atomic<int64_t>& batches = RpcMetrics::GetInstance().Counter("provider.microbatch_batches");
+    static std::atomic<int64_t>& items = RpcMetrics::GetInstance().Counter("provider.microbatch_items");
+    batches.fetch_add(1, std::memory_order_relaxed);
+    items.fetch_add(calls->size(), std::memory_order_relaxed);
+
+    // 一批请求可能来自不同的连接和租户，作为该方法的一个流调度
+    MethodInfo* methodInfo = calls->front()->methodInfo_;
+    executor_->Submit(
+        methodInfo->priority_,
+        "batch:" + methodInfo->method_->full_name(),
+        [this, calls]() { CallServiceMethodBatch(calls); },
+        [this, calls]() {
+            for (CallContext* call : *calls) {
+                ShedRpcCall(call, rpcheader::RPC_OVERLOADED, "request shed: queued too long");
+            }
+            delete calls;
+        }
+    );
+}
+
+void RpcProvider::CallServiceMethodBatch(std::vector<CallContext*>* calls) {
+    static std::atomic<int64_t>& deadline_exceeded = RpcMetrics::GetInstance().Counter("provider.deadline_exceeded");
+    MethodInfo* methodInfo = calls->front()->methodInfo_;
+
+    // 已超过截止时间的请求不参与这一批的执行
+    auto now = std::chrono::steady_clock::now();
+    auto expired = std::stable_partition(calls->begin(), calls->end(),
+                                         [now](CallContext* call) { return now < call->deadline_; });
+    for (auto it = expired; it != calls->end(); ++it) {
+        deadline_exceeded.fetch_add(1, std::memory_order_relaxed);
+        ShedRpcCall(*it, rpcheader::RPC_DEADLINE_EXCEEDED, "deadline exceeded");
+    }
+    calls->erase(expired, calls->end());
+    if (calls->empty()) {
+        delete calls;
+        return;
+    }
+
+    // done 回调可能在 CallMethodBatch 返回前就释放了 calls，先取出 request 及其长度
+    std::vector<const google::protobuf::Message*> requests;
+    std::vector<google::protobuf::Message*> responses;
+    std::vector<std::pair<google::protobuf::Message*, size_t>> owned;
+    requests.reserve(calls->size());
+    responses.reserve(calls->size());
+    owned.reserve(calls->size());
+    for (CallContext* call : *calls) {
+        requests.push_back(call->request_);
+        responses.push_back(call->response_);
+        owned.emplace_back(call->request_, call->requestBytes_);
+    }
+
+    google::protobuf::Closure* done = google::protobuf::NewCallback<RpcProvider, std::vector<CallContext*>*>(
+        this,
+        &RpcProvider::SendRpcResponseBatch,
+        calls
+    );
+    methodInfo->batcher_->service_->CallMethodBatch(methodInfo->method_, requests, responses, done);
+
+    // 释放request内存
+    for (const auto& request : owned) {
+        DeleteMessage(methodInfo->requestPool_.get(), request.first, request.second);
+    }
+}
+
+void RpcProvider::SendRpcResponseBatch(std::vector<CallContext*>* calls) {
+    for (CallContext* call : *calls) {
+        SendRpcResponse(call);
+    }
+    delete calls;
+}
+
+void RpcProvider::ShedRpcCall(CallContext* call, int status, const std::string& error_text) {
+    // 请求没有真正执行，不提交 RTT 样本
+    if (serverLimiter_) {
+        serverLimiter_->Cancel();
+        call->methodInfo_->limiter_->Cancel();
+    }
+
+    if (call->methodInfo_->streaming_) {
+        FinishStream(call);
+    }
+    SendRpcError(call->reply_, call->request_id_, status, error_text);
+
+    // 未执行的请求，响应消息仍为空
+    DeleteMessage(call->methodInfo_->requestPool_.get(), call->request_, call->requestBytes_);
+    DeleteMessage(call->methodInfo_->responsePool_.get(), call->response_, 0);
+    ReleaseCall(call);
 }
 
 // rpc方法调用完成后的回调函数
-void RpcProvider::SendRpcResponse(std::shared_ptr<Session> session, google::protobuf::Message* response) {
+void RpcProvider::SendRpcResponse(CallContext* call) {
+    // 归还并发名额，并以本次调用耗时作为 RTT 样本
+    if (serverLimiter_) {
+        auto rtt = std::chrono::steady_clock::now() - call->start_;
+        serverLimiter_->Release(rtt);
+        call->methodInfo_->limiter_->Release(rtt);
+    }
+
+    // 流式调用：服务方法执行 done 即结束流，成功时按一元响应发送最终响应帧（客户端流携带响应消息）
+    if (call->methodInfo_->streaming_) {
+        RpcStream* stream = call->controller_.GetStream();
+        bool flow_control_error = stream && stream->FlowControlError();
+        FinishStream(call);
+        if (flow_control_error) {
+            SendRpcError(call->reply_, call->request_id_, rpcheader::RPC_BAD_REQUEST, "stream flow control window exceeded");
+            DeleteMessage(call->methodInfo_->responsePool_.get(), call->response_);
+            ReleaseCall(call);
+            return;
+        }
+    }
+    // 服务方法通过 controller->SetFailed 报告失败
+    if (call->controller_.Failed()) {
+        SendRpcError(call->reply_, call->request_id_, rpcheader::RPC_METHOD_FAILED, call->controller_.ErrorText());
+        DeleteMessage(call->methodInfo_->responsePool_.get(), call->response_);
+        ReleaseCall(call);
+        return;
+    }
+
+    // 单向请求不序列化、不发送响应
+    if (call->reply_.oneWay_) {
+        DeleteMessage(call->methodInfo_->responsePool_.get(), call->response_);
+        ReleaseCall(call);
+        return;
+    }
+
     // ==== 组织 rpc 响应的字符流，并通过网络发送回 rpc 调用方 ====
     /**
-     * 使用长度前缀方式发送响应，避免消息边界问题
+     * 响应字符流与请求的格式一致，避免消息边界问题
      * 字符流包含的信息：
-     * 1.响应数据的长度 response_size (4字节)
-     * 2.响应消息 response_str
+     * 1.数据头的长度 header_size (4字节)
+     * 2.数据头 header_str: status + error_text + body_size
+     * 3.响应消息 response_str
      */
 
-    std::string response_str;
-    // 序列化响应消息
-    if (response->SerializeToString(&response_str)) {
-        uint32_t response_len = htonl(response_str.size());  // 主机字节序转网络字节序
-        
-        // 组装发送数据：4字节长度 + 响应消息体
-        std::string send_buf;
-        send_buf.append((char*)&response_len, 4);
-        send_buf.append(response_str);
-        
-        // 发送响应数据
-        session->DoWrite(send_buf);
+    // 响应消息只序列化一次，直接写入发送缓冲区（或压缩、分块发送的消息体）
+    size_t body_size = call->response_->ByteSizeLong();
+    bool serialized = true;
+    const google::protobuf::MethodDescriptor* method = call->methodInfo_->method_;
+    RpcCompressor& compressor = RpcCompressor::GetInstance();
+    uint32_t peer_mask = call->reply_.session_->PeerCompression();
+    // 批量响应的子响应不压缩、不分块
+    bool compress = !call->reply_.batch_ && compressor.WouldCompress(method, body_size, peer_mask);
+    bool chunked = !call->reply_.batch_ && chunkSize_ > 0 && body_size > chunkSize_;
+    // 超过客户端在握手中声明的上限时回复错误，而不是发送一个会让客户端断开连接的响应
+    size_t max_message_size = maxMessageSize_;
+    uint64_t peer_max = call->reply_.session_->PeerMaxMessageSize();
+    if (peer_max != 0 && peer_max < max_message_size) {
+        max_message_size = peer_max;
+    }
+    // 服务方法通过 controller->SetMetadata 设置的响应元数据，只放在最终的响应帧中
+    const std::string& metadata = call->controller_.OutgoingMetadata();
+    if (body_size > max_message_size) {
+        std::cerr << "RpcProvider::SendRpcResponse response size " << body_size << " exceeds max message size" << std::endl;
+        SendRpcError(call->reply_, call->request_id_, rpcheader::RPC_METHOD_FAILED, "response exceeds max message size");
+    } else if (metadata.size() > RpcFrame::kMaxMetadataSize) {
+        std::cerr << "RpcProvider::SendRpcResponse metadata size " << metadata.size() << " exceeds max size" << std::endl;
+        SendRpcError(call->reply_, call->request_id_, rpcheader::RPC_METHOD_FAILED, "response metadata exceeds max size");
+    } else if (compress || chunked) {
+        std::string body;
+        serialized = call->response_->SerializeToString(&body);
+        if (serialized) {
+            rpcheader::RpcResponseHeader header;
+            header.set_status(rpcheader::RPC_OK);
+            header.set_request_id(call->request_id_);
+            header.set_metadata(metadata);
+            int compression = compress ? compressor.Compress(method, peer_mask, &body) : rpcheader::COMPRESS_NONE;
+            if (chunkSize_ > 0 && body.size() > chunkSize_) {
+                // 大响应（压缩后）分块发送，压缩信息只在最终帧的数据头中
+                rpcheader::RpcResponseHeader chunk;
+                chunk.set_request_id(call->request_id_);
+                chunk.set_frame_type(rpcheader::FRAME_CHUNK);
+                chunk.set_body_size(chunkSize_);
+                std::string chunk_header = EncodeResponseHeader(chunk, call->reply_.fixed_);
+                header.set_body_size(ChunkedFrame::LastChunkSize(body.size(), chunkSize_));
+                if (compression != rpcheader::COMPRESS_NONE) {
+                    header.set_compression(static_cast<rpcheader::CompressionType>(compression));
+                    header.set_uncompressed_size(body_size);
+                }
+                std::string final_header = EncodeResponseHeader(header, call->reply_.fixed_);
+                call->reply_.session_->DoWriteChunked(std::unique_ptr<ChunkedFrame>(
+                    new ChunkedFrame(std::move(chunk_header), std::move(final_header), std::move(body), chunkSize_)));
+            } else {
+                header.set_body_size(body.size());
+                if (compression != rpcheader::COMPRESS_NONE) {
+                    header.set_compression(static_cast<rpcheader::CompressionType>(compression));
+                    header.set_uncompressed_size(body_size);
+                }
+                std::string send_buf = EncodeResponseHeader(header, call->reply_.fixed_);
+                send_buf.append(body);
+                Reply(call->reply_, std::move(send_buf));
+            }
+        }
     } else {
+        rpcheader::RpcResponseHeader header;
+        header.set_status(rpcheader::RPC_OK);
+        header.set_body_size(body_size);
+        header.set_request_id(call->request_id_);
+        header.set_metadata(metadata);
+
+        // 组装发送数据：数据头 + 响应消息体
+        std::string send_buf = EncodeResponseHeader(header, call->reply_.fixed_);
+        size_t header_end = send_buf.size();
+        send_buf.resize(header_end + body_size);
+        serialized = call->response_->SerializeToArray(&send_buf[header_end], body_size);
+        if (serialized) {
+            // 发送响应数据
+            Reply(call->reply_, std::move(send_buf));
+        }
+    }
+    if (!serialized) {
         std::cerr << "RpcProvider::SendRpcResponse serialize response error!" << std::endl;
+        if (call->reply_.batch_) {
+            // 批量请求需要凑齐所有子响应
+            SendRpcError(call->reply_, call->request_id_, rpcheader::RPC_BAD_REQUEST, "serialize response error");
+        }
     }
     // 释放response内存
-    delete response;
+    DeleteMessage(call->methodInfo_->responsePool_.get(), call->response_, body_size);
+    ReleaseCall(call);
+}
+
+void RpcProvider::PushSession(SessionShard& shard, Session* session) {
+    session->lruPrev_ = shard.tail_;
+    session->lruNext_ = nullptr;
+    if (shard.tail_) {
+        shard.tail_->lruNext_ = session;
+    } else {
+        shard.head_ = session;
+    }
+    shard.tail_ = session;
+    session->lruLinked_ = true;
+}
+
+void RpcProvider::RemoveSession(SessionShard& shard, Session* session) {
+    if (session->lruPrev_) {
+        session->lruPrev_->lruNext_ = session->lruNext_;
+    } else {
+        shard.head_ = session->lruNext_;
+    }
+    if (session->lruNext_) {
+        session->lruNext_->lruPrev_ = session->lruPrev_;
+    } else {
+        shard.tail_ = session->lruPrev_;
+    }
+    session->lruPrev_ = nullptr;
+    session->lruNext_ = nullptr;
+    session->lruLinked_ = false;
+}
+
+void RpcProvider::LinkSession(Session* session) {
+    static std::atomic<int64_t>& connections = RpcMetrics::GetInstance().Counter("provider.connections");
+
+    SessionShard& shard = sessionShards_[session->GetId() % kIoThreads];
+    std::lock_guard<std::mutex> lock(shard.mutex_);
+    session->lastActive_.store(coarseNow_.load(std::memory_order_relaxed), std::memory_order_relaxed);
+    PushSession(shard, session);
+    connections.fetch_add(1, std::memory_order_relaxed);
+}
+
+void RpcProvider::UnlinkSession(Session* session) {
+    static std::atomic<int64_t>& connections = RpcMetrics::GetInstance().Counter("provider.connections");
+
+    SessionShard& shard = sessionShards_[session->GetId() % kIoThreads];
+    std::lock_guard<std::mutex> lock(shard.mutex_);
+    if (session->lruLinked_) {
+        RemoveSession(shard, session);
+        connections.fetch_sub(1, std::memory_order_relaxed);
+    }
+}
+
+void RpcProvider::TouchSession(Session* session) {
+    SessionShard& shard = sessionShards_[session->GetId() % kIoThreads];
+    std::lock_guard<std::mutex> lock(shard.mutex_);
+    session->lastActive_.store(coarseNow_.load(std::memory_order_relaxed), std::memory_order_relaxed);
+    if (session->lruLinked_ && shard.tail_ != session) {
+        RemoveSession(shard, session);
+        PushSession(shard, session);
+    }
+}
+
+void RpcProvider::SweepSessions() {
+    static std::atomic<int64_t>& connections = RpcMetrics::GetInstance().Counter("provider.connections");
+    static std::atomic<int64_t>& idle_closed = RpcMetrics::GetInstance().Counter("provider.connections_idle_closed");
+
+    uint32_t now = coarseNow_.fetch_add(1, std::memory_order_relaxed) + 1;
+    if (idleTimeout_ > 0) {
+        std::vector<std::shared_ptr<Session>> idle;
+        for (SessionShard& shard : sessionShards_) {
+            std::lock_guard<std::mutex> lock(shard.mutex_);
+            // 表头最久未活动，遇到第一个未超时的会话即可停止
+            while (shard.head_ && now - shard.head_->lastActive_.load(std::memory_order_relaxed) >= idleTimeout_) {
+                Session* session = shard.head_;
+                RemoveSession(shard, session);
+                if (session->calls_.load(std::memory_order_relaxed) > 0) {
+                    // 有执行中的请求（如长时间的流式调用），不算空闲
+                    session->lastActive_.store(now, std::memory_order_relaxed);
+                    PushSession(shard, session);
+                    continue;
+                }
+                connections.fetch_sub(1, std::memory_order_relaxed);
+                // 正在析构的会话（等待这把锁以从链表中移除）取不到 shared_ptr，移出链表即可
+                std::shared_ptr<Session> alive = session->weak_from_this().lock();
+                if (alive) {
+                    idle.push_back(std::move(alive));
+                }
+            }
+        }
+        for (std::shared_ptr<Session>& session : idle) {
+            session->Close();
+        }
+        idle_closed.fetch_add(static_cast<int64_t>(idle.size()), std::memory_order_relaxed);
+    }
+
+    sweepTimer_->expires_after(std::chrono::seconds(1));
+    sweepTimer_->async_wait([this](const boost::system::error_code& ec) {
+        if (!ec) {
+            SweepSessions();
+        }
+    });
+}
+
+bool RpcProvider::EvictIdleSession() {
+    static std::atomic<int64_t>& connections = RpcMetrics::GetInstance().Counter("provider.connections");
+    static std::atomic<int64_t>& evicted = RpcMetrics::GetInstance().Counter("provider.connections_evicted");
+
+    // 只比较各分片的表头，开销与连接数无关
+    uint32_t now = coarseNow_.load(std::memory_order_relaxed);
+    int oldest = -1;
+    uint32_t oldest_idle = 0;
+    for (int i = 0; i < kIoThreads; ++i) {
+        std::lock_guard<std::mutex> lock(sessionShards_[i].mutex_);
+        Session* head = sessionShards_[i].head_;
+        if (head && head->calls_.load(std::memory_order_relaxed) == 0) {
+            uint32_t idle = now - head->lastActive_.load(std::memory_order_relaxed);
+            if (oldest < 0 || idle > oldest_idle) {
+                oldest = i;
+                oldest_idle = idle;
+            }
+        }
+    }
+    if (oldest < 0) {
+        return false;
+    }
+
+    std::shared_ptr<Session> victim;
+    {
+        SessionShard& shard = sessionShards_[oldest];
+        std::lock_guard<std::mutex> lock(shard.mutex_);
+        Session* head = shard.head_;
+        if (!head || head->calls_.load(std::memory_order_relaxed) > 0) {
+            return false;   // 比较之后表头已经变化
+        }
+        RemoveSession(shard, head);
+        connections.fetch_sub(1, std::memory_order_relaxed);
+        victim = head->weak_from_this().lock();
+    }
+    if (victim) {
+        victim->Close();
+    }
+    evicted.fetch_add(1, std::memory_order_relaxed);
+    return true;
+}
+
+void RpcProvider::TrackStream(const std::shared_ptr<RpcStream>& stream) {
+    std::lock_guard<std::mutex> lock(liveStreamsMutex_);
+    if (liveStreams_.size() >= liveStreamsPrune_) {
+        // 结束的流随调用上下文释放，清理后按剩余数量调整下次清理的长度，均摊开销为常数
+        liveStreams_.erase(std::remove_if(liveStreams_.begin(), liveStreams_.end(),
+                                          [](const std::weak_ptr<RpcStream>& live) { return live.expired(); }),
+                           liveStreams_.end());
+        liveStreamsPrune_ = std::max<size_t>(64, liveStreams_.size() * 2);
+    }
+    liveStreams_.push_back(stream);
+}
+
+void RpcProvider::CloseLiveStreams() {
+    std::vector<std::weak_ptr<RpcStream>> streams;
+    {
+        std::lock_guard<std::mutex> lock(liveStreamsMutex_);
+        streams.swap(liveStreams_);
+    }
+    for (std::weak_ptr<RpcStream>& live : streams) {
+        if (std::shared_ptr<RpcStream> stream = live.lock()) {
+            stream->Close();
+        }
+    }
+}
+
+void RpcProvider::ReleaseCall(CallContext* call) {
+    int64_t bytes = static_cast<int64_t>(call->requestBytes_);
+    call->reply_.session_->Charge(RpcMemoryBudget::Kind::Call, -bytes);
+    call->reply_.session_->AddCalls(-1);
+    call->methodInfo_->memoryBytes_->fetch_sub(bytes, std::memory_order_relaxed);
+    delete call;
+}
+
+void RpcProvider::FinishStream(CallContext* call) {
+    std::shared_ptr<RpcStream> stream = call->reply_.session_->FindStream(call->request_id_);
+    call->reply_.session_->RemoveStream(call->request_id_);
+    if (stream) {
+        stream->Close();
+    }
+    call->controller_.SetStream(nullptr);
+}
+
+void RpcProvider::SendRpcError(const ReplyTarget& reply, uint64_t request_id, int status, const std::string& error_text) {
+    rpcheader::RpcResponseHeader header;
+    header.set_request_id(request_id);
+    header.set_status(static_cast<rpcheader::RpcStatus>(status));
+    header.set_error_text(error_text);
+    header.set_body_size(0);
+
+    Reply(reply, EncodeResponseHeader(header, reply.fixed_));
+}
+
+void RpcProvider::Reply(const ReplyTarget& reply, std::string frame) {
+    if (reply.oneWay_) {
+        return;     // 单向请求的错误响应也不发送
+    }
+    BatchContext* batch = reply.batch_.get();
+    if (!batch) {
+        reply.session_->DoWrite(std::move(frame));
+        return;
+    }
+
+    // 每个位置只由一个线程写入；最后一个就绪的子响应负责发送，acq_rel 保证它能看到其他位置的写入
+    batch->responses_[reply.index_] = std::move(frame);
+    if (batch->remaining_.fetch_sub(1, std::memory_order_acq_rel) != 1) {
+        return;
+    }
+
+    size_t body_size = 0;
+    for (const std::string& response : batch->responses_) {
+        body_size += response.size();
+    }
+    rpcheader::RpcResponseHeader header;
+    header.set_status(rpcheader::RPC_OK);
+    header.set_body_size(body_size);
+    header.set_request_id(batch->request_id_);
+    header.set_batch_count(batch->responses_.size());
+
+    // 批量响应：4字节 header_size + 数据头 + 依次拼接的子响应（批量请求只使用 protobuf 数据头）
+    std::string send_buf = EncodeResponseHeader(header, false);
+    send_buf.reserve(send_buf.size() + body_size);
+    for (const std::string& response : batch->responses_) {
+        send_buf.append(response);
+    }
+    batch->session_->DoWrite(std::move(send_buf));
 }
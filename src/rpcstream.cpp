@@ -0,0 +1,132 @@
+#include "rpcstream.h"
+
+RpcStream::RpcStream(uint32_t window, MessageSender send_message, CreditSender send_credit, EndSender send_end,
+                     ResetSender send_reset)
+    : window_(window > 0 ? window : 1),
+      sendMessage_(std::move(send_message)),
+      sendCredit_(std::move(send_credit)),
+      sendEnd_(std::move(send_end)),
+      sendReset_(std::move(send_reset)) {
+    // 接收消息的一端在建立流时授出整个窗口（客户端在请求头中，服务端在第一个授信帧中）
+    granted_ = sendCredit_ ? window_ : 0;
+}
+
+bool RpcStream::Read(google::protobuf::Message* message) {
+    std::string data;
+    uint32_t credit = 0;
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        cond_.wait(lock, [this]() { return !messages_.empty() || ended_ || closed_; });
+        if (messages_.empty()) {
+            return false;
+        }
+        data = std::move(messages_.front());
+        messages_.pop_front();
+
+        // 每消费一半窗口追加一次授信，避免每条消息都发送授信帧
+        if (++consumed_ >= (window_ + 1) / 2 && !ended_ && !closed_) {
+            credit = consumed_;
+            consumed_ = 0;
+            granted_ += credit;     // 先计入再发送，对端用这些额度发送的消息不会被误判
+        }
+    }
+    if (credit > 0 && sendCredit_) {
+        sendCredit_(credit);
+    }
+    return message->ParseFromString(data);
+}
+
+bool RpcStream::Write(const google::protobuf::Message& message) {
+    std::string data;
+    if (!sendMessage_ || !message.SerializeToString(&data)) {
+        return false;
+    }
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        cond_.wait(lock, [this]() { return credits_ > 0 || closed_ || writesDone_; });
+        if (closed_ || writesDone_) {
+            return false;
+        }
+        --credits_;
+    }
+    sendMessage_(std::move(data));
+    return true;
+}
+
+void RpcStream::WritesDone() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (writesDone_ || closed_) {
+            return;
+        }
+        writesDone_ = true;
+    }
+    cond_.notify_all();
+    if (sendEnd_) {
+        sendEnd_();
+    }
+}
+
+void RpcStream::Wait() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    cond_.wait(lock, [this]() { return closed_; });
+}
+
+bool RpcStream::OnMessage(std::string message) {
+    bool exceeded = false;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (ended_ || closed_) {
+            return true;
+        }
+        if (granted_ > 0) {
+            --granted_;
+            messages_.push_back(std::move(message));
+        } else {
+            // 对端无视授信窗口：已缓存的消息不再交给读取方，之后的消息直接丢弃
+            flowControlError_ = true;
+            ended_ = true;
+            messages_.clear();
+            exceeded = true;
+        }
+    }
+    // 越界时同样唤醒阻塞在 Read 上的读取方，让它看到流已结束
+    cond_.notify_all();
+    if (!exceeded) {
+        return true;
+    }
+    if (sendReset_) {
+        sendReset_();
+    }
+    return false;
+}
+
+void RpcStream::OnCredit(uint32_t credit) {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        credits_ += credit;
+    }
+    cond_.notify_all();
+}
+
+void RpcStream::OnEnd() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        ended_ = true;
+    }
+    cond_.notify_all();
+}
+
+bool RpcStream::FlowControlError() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return flowControlError_;
+}
+
+void RpcStream::Close() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        ended_ = true;
+        closed_ = true;
+    }
+    cond_.notify_all();
+}